@@ -7,6 +7,7 @@
 #include <etl/concepts.hpp>
 #include <etl/cstdint.hpp>
 #include <etl/random.hpp>
+#include <etl/span.hpp>
 
 namespace grit {
 
@@ -23,18 +24,27 @@ struct AirWindowsFireAmp
         Float tone   = Float(0.5);
         Float output = Float(0.8);
         Float mix    = Float(1);
+
+        friend auto operator==(Parameter const& lhs, Parameter const& rhs) -> bool = default;
     };
 
     AirWindowsFireAmp() = default;
     explicit AirWindowsFireAmp(SeedType seed);
 
+    /// Only recomputes the coefficients if the parameter changed.
     auto setParameter(Parameter parameter) -> void;
     auto setSampleRate(Float sampleRate) -> void;
 
     [[nodiscard]] auto operator()(Float x) -> Float;
     auto reset() -> void;
 
+    /// Processes a block of samples. Equivalent to calling operator() on every sample.
+    /// \pre input.size() == output.size(), input & output may alias
+    auto process(etl::span<Float const> input, etl::span<Float> output) -> void;
+
 private:
+    auto update() -> void;
+
     static constexpr auto sineLUT = StaticLookupTableTransform<Float, 255>{
         [](auto x) { return etl::sin(x); },
         Float(0),
@@ -136,8 +146,17 @@ AirWindowsFireAmp<Float, URNG>::AirWindowsFireAmp(SeedType seed) : _rng{seed}
 template<etl::floating_point Float, typename URNG>
 auto AirWindowsFireAmp<Float, URNG>::setParameter(Parameter parameter) -> void
 {
+    if (parameter == _parameter) {
+        return;
+    }
+
     _parameter = parameter;
+    update();
+}
 
+template<etl::floating_point Float, typename URNG>
+auto AirWindowsFireAmp<Float, URNG>::update() -> void
+{
     static constexpr auto const pi = static_cast<Float>(etl::numbers::pi);
 
     auto const a = _parameter.gain;
@@ -236,7 +255,7 @@ auto AirWindowsFireAmp<Float, URNG>::setSampleRate(Float sampleRate) -> void
 {
     _sampleRate = sampleRate;
     reset();
-    setParameter(_parameter);
+    update();
 }
 
 template<etl::floating_point Float, typename URNG>
@@ -723,6 +742,14 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     return inputSampleL;
 }
 
+template<etl::floating_point Float, typename URNG>
+auto AirWindowsFireAmp<Float, URNG>::process(etl::span<Float const> input, etl::span<Float> output) -> void
+{
+    for (auto i = etl::size_t(0); i < input.size(); ++i) {
+        output[i] = (*this)(input[i]);
+    }
+}
+
 template<etl::floating_point Float, typename URNG>
 auto AirWindowsFireAmp<Float, URNG>::reset() -> void
 {
@@ -777,7 +804,8 @@ auto AirWindowsFireAmp<Float, URNG>::reset() -> void
     }
     _cycle = 0;  // undersampling
 
-    for (int x = 0; x < FixTotal; x++) {
+    // Only the filter state, the coefficients stay valid for the current parameter.
+    for (int x = FixSL1; x <= FixSL2; x++) {
         _fixA[x] = 0.0;
         _fixB[x] = 0.0;
         _fixC[x] = 0.0;
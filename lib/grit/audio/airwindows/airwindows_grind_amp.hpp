@@ -7,6 +7,7 @@
 #include <etl/concepts.hpp>
 #include <etl/cstdint.hpp>
 #include <etl/random.hpp>
+#include <etl/span.hpp>
 
 namespace grit {
 
@@ -23,18 +24,27 @@ struct AirWindowsGrindAmp
         Float tone   = Float(0.5);
         Float output = Float(0.8);
         Float mix    = Float(1);
+
+        friend auto operator==(Parameter const& lhs, Parameter const& rhs) -> bool = default;
     };
 
     AirWindowsGrindAmp();
     explicit AirWindowsGrindAmp(SeedType seed);
 
+    /// Only recomputes the coefficients if the parameter changed.
     auto setParameter(Parameter parameter) -> void;
     auto setSampleRate(Float sampleRate) -> void;
 
     [[nodiscard]] auto operator()(Float x) -> Float;
     auto reset() -> void;
 
+    /// Processes a block of samples. Equivalent to calling operator() on every sample.
+    /// \pre input.size() == output.size(), input & output may alias
+    auto process(etl::span<Float const> input, etl::span<Float> output) -> void;
+
 private:
+    auto update() -> void;
+
     static constexpr auto sineLUT = StaticLookupTableTransform<Float, 255>{
         [](auto x) { return etl::sin(x); },
         Float(0),
@@ -150,8 +160,17 @@ AirWindowsGrindAmp<Float, URNG>::AirWindowsGrindAmp(SeedType seed) : _rng{seed}
 template<etl::floating_point Float, typename URNG>
 auto AirWindowsGrindAmp<Float, URNG>::setParameter(Parameter parameter) -> void
 {
+    if (parameter == _parameter) {
+        return;
+    }
+
     _parameter = parameter;
+    update();
+}
 
+template<etl::floating_point Float, typename URNG>
+auto AirWindowsGrindAmp<Float, URNG>::update() -> void
+{
     static constexpr auto const pi = static_cast<Float>(etl::numbers::pi);
 
     auto const a = _parameter.gain;
@@ -250,7 +269,7 @@ auto AirWindowsGrindAmp<Float, URNG>::setSampleRate(Float sampleRate) -> void
 {
     _sampleRate = sampleRate;
     reset();
-    setParameter(_parameter);
+    update();
 }
 
 template<etl::floating_point Float, typename URNG>
@@ -795,6 +814,14 @@ auto AirWindowsGrindAmp<Float, URNG>::operator()(Float const x) -> Float
     return input;
 }
 
+template<etl::floating_point Float, typename URNG>
+auto AirWindowsGrindAmp<Float, URNG>::process(etl::span<Float const> input, etl::span<Float> output) -> void
+{
+    for (auto i = etl::size_t(0); i < input.size(); ++i) {
+        output[i] = (*this)(input[i]);
+    }
+}
+
 template<etl::floating_point Float, typename URNG>
 auto AirWindowsGrindAmp<Float, URNG>::reset() -> void
 {
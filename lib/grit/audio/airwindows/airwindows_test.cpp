@@ -39,6 +39,51 @@ static auto test(auto sampleRate, typename Processor::SampleType offset = 0) ->
             }
         }
     }
+
+    SECTION("block matches per sample")
+    {
+        auto block = proc;
+
+        for (auto b{0}; b < 16; ++b) {
+            auto buffer = etl::array<Float, 32>{};
+            etl::generate(buffer.begin(), buffer.end(), [&] { return signal(rng); });
+
+            auto expected = buffer;
+            for (auto& x : expected) {
+                x = proc(x);
+            }
+
+            block.process(buffer, buffer);
+            for (auto i = size_t(0); i < buffer.size(); ++i) {
+                REQUIRE(buffer[i] == Catch::Approx(expected[i]));
+            }
+        }
+    }
+
+    if constexpr (requires { typename Processor::Parameter; }) {
+        SECTION("unchanged parameter survives reset & sample rate change")
+        {
+            auto const a         = etl::clamp(param(rng) - offset, Float(0), Float(1));
+            auto const parameter = typename Processor::Parameter{a, param(rng), param(rng), param(rng)};
+
+            auto expected = Processor{42};
+            expected.setSampleRate(sampleRate);
+            expected.setParameter(parameter);
+
+            auto cached = Processor{42};
+            cached.setSampleRate(sampleRate * Float(2));
+            cached.setParameter(parameter);
+            cached.setSampleRate(sampleRate);
+            cached.setParameter(parameter);
+            cached.reset();
+            cached.setParameter(parameter);
+
+            for (auto i{0}; i < 1'024; ++i) {
+                auto const x = signal(rng);
+                REQUIRE(cached(x) == Catch::Approx(expected(x)));
+            }
+        }
+    }
 }
 
 TEMPLATE_TEST_CASE("audio/airwindows: AirWindowsFireAmp", "", float, double)
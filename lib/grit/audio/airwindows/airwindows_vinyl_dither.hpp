@@ -5,6 +5,7 @@
 #include <etl/cmath.hpp>
 #include <etl/concepts.hpp>
 #include <etl/random.hpp>
+#include <etl/span.hpp>
 
 namespace grit {
 
@@ -24,6 +25,10 @@ struct AirWindowsVinylDither
     [[nodiscard]] auto operator()(Float x) -> Float;
     auto reset() -> void;
 
+    /// Processes a block of samples. Equivalent to calling operator() on every sample.
+    /// \pre input.size() == output.size(), input & output may alias
+    auto process(etl::span<Float const> input, etl::span<Float> output) -> void;
+
 private:
     auto advanceNoise() -> Float;
 
@@ -96,6 +101,14 @@ auto AirWindowsVinylDither<Float, URNG>::operator()(Float x) -> Float
     return floor * _outScale;
 }
 
+template<etl::floating_point Float, typename URNG>
+auto AirWindowsVinylDither<Float, URNG>::process(etl::span<Float const> input, etl::span<Float> output) -> void
+{
+    for (auto i = etl::size_t(0); i < input.size(); ++i) {
+        output[i] = (*this)(input[i]);
+    }
+}
+
 template<etl::floating_point Float, typename URNG>
 auto AirWindowsVinylDither<Float, URNG>::reset() -> void
 {
@@ -0,0 +1,10 @@
+#pragma once
+
+/// \defgroup grit-audio-batch Batch
+/// \ingroup grit-audio
+
+#include <grit/audio/batch/batch.hpp>
+#include <grit/audio/batch/batch_dynamic_smoothing.hpp>
+#include <grit/audio/batch/batch_envelope_adsr.hpp>
+#include <grit/audio/batch/batch_oscillator.hpp>
+#include <grit/audio/batch/batch_state_variable_filter.hpp>
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <etl/cstddef.hpp>
+
+namespace grit {
+
+/// \brief Lanes instances of Processor with their state stored structure-of-arrays.
+///
+/// \details Every member is an array with one element per lane, so the
+/// per-sample loops run over contiguous memory and vectorize across lanes.
+/// Samples are passed as Batch::Frame, one value per lane. Each lane matches
+/// a scalar Processor with the same parameters.
+///
+/// Only specializations are defined. Supported are Oscillator,
+/// WavetableOscillator, EnvelopeADSR, StateVariableFilter and
+/// DynamicSmoothing.
+///
+/// \ingroup grit-audio-batch
+template<typename Processor, etl::size_t Lanes>
+struct Batch;
+
+}  // namespace grit
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <grit/audio/batch/batch.hpp>
+#include <grit/audio/filter/dynamic_smoothing.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/concepts.hpp>
+
+namespace grit {
+
+/// \brief DynamicSmoothing for Lanes parameters.
+/// \ingroup grit-audio-batch
+template<etl::floating_point Float, etl::size_t Lanes>
+struct Batch<DynamicSmoothing<Float>, Lanes>
+{
+    using SampleType = Float;
+    using Frame      = etl::array<Float, Lanes>;
+
+    Batch() = default;
+
+    [[nodiscard]] static constexpr auto lanes() -> etl::size_t { return Lanes; }
+
+    auto setSampleRate(Float sampleRate) -> void { _wc = _baseFrequency / sampleRate; }
+
+    auto reset() -> void
+    {
+        _low1.fill(Float(0));
+        _low2.fill(Float(0));
+        _inz.fill(Float(0));
+    }
+
+    [[nodiscard]] auto operator()(Frame const& input) -> Frame
+    {
+        auto const x1 = Float(5.9948827);
+        auto const x2 = Float(-11.969296);
+        auto const x3 = Float(15.959062);
+
+        for (auto i = etl::size_t(0); i < Lanes; ++i) {
+            auto const low1z = _low1[i];
+            auto const low2z = _low2[i];
+            auto const bandz = low1z - low2z;
+
+            auto const wd = _wc + _sensitivity * etl::abs(bandz);
+            auto const g  = etl::min(wd * (x1 + wd * (x2 + wd * x3)), Float(1));
+
+            _low1[i] = low1z + g * (Float(0.5) * (input[i] + _inz[i]) - low1z);
+            _low2[i] = low2z + g * (Float(0.5) * (_low1[i] + low1z) - low2z);
+            _inz[i]  = input[i];
+        }
+
+        return _low2;
+    }
+
+private:
+    Float _baseFrequency{2.0};
+    Float _sensitivity{0.5};
+    Float _wc{};
+    Frame _low1{};
+    Frame _low2{};
+    Frame _inz{};
+};
+
+}  // namespace grit
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <grit/audio/batch/batch.hpp>
+#include <grit/audio/envelope/envelope_adsr.hpp>
+
+#include <etl/array.hpp>
+#include <etl/concepts.hpp>
+#include <etl/cstdint.hpp>
+
+namespace grit {
+
+/// \brief EnvelopeADSR for Lanes voices. Parameters are shared, gates are per lane.
+/// \details Every lane stores the one-pole coefficients and the bounds of its
+/// current segment. The per-sample loop is the same multiply-add for all
+/// lanes, stage transitions are handled in a separate pass which only runs
+/// when a lane crossed its bounds.
+/// \ingroup grit-audio-batch
+template<etl::floating_point Float, etl::size_t Lanes>
+struct Batch<EnvelopeADSR<Float>, Lanes>
+{
+    using SampleType = Float;
+    using Frame      = etl::array<Float, Lanes>;
+    using Parameter  = typename EnvelopeADSR<Float>::Parameter;
+
+    Batch()
+    {
+        update();
+        reset();
+    }
+
+    [[nodiscard]] static constexpr auto lanes() -> etl::size_t { return Lanes; }
+
+    auto setParameter(Parameter const& parameter) -> void
+    {
+        _parameter = parameter;
+        update();
+    }
+
+    auto setSampleRate(Float sampleRate) -> void
+    {
+        _sampleRate = sampleRate;
+        update();
+        reset();
+    }
+
+    auto gate(etl::size_t lane, bool isOn) -> void
+    {
+        if (isOn) {
+            enter(lane, Attack);
+        } else if (_state[lane] != Idle) {
+            enter(lane, Release);
+        }
+    }
+
+    auto reset() -> void
+    {
+        _output.fill(Float(0));
+        for (auto i = etl::size_t(0); i < Lanes; ++i) {
+            enter(i, Idle);
+        }
+    }
+
+    [[nodiscard]] auto operator()() -> Frame
+    {
+        auto crossed = 0;
+        for (auto i = etl::size_t(0); i < Lanes; ++i) {
+            auto const next = _base[i] + _output[i] * _coef[i];
+            crossed |= static_cast<int>(next >= _upper[i]) | static_cast<int>(next <= _lower[i]);
+            _output[i] = next;
+        }
+
+        if (crossed != 0) [[unlikely]] {
+            transition();
+        }
+
+        return _output;
+    }
+
+private:
+    enum State : etl::uint8_t
+    {
+        Idle,
+        Attack,
+        Decay,
+        Sustain,
+        Release
+    };
+
+    auto transition() -> void
+    {
+        for (auto i = etl::size_t(0); i < Lanes; ++i) {
+            if (_state[i] == Attack and _output[i] >= _upper[i]) {
+                _output[i] = Float(1);
+                enter(i, Decay);
+            } else if (_state[i] == Decay and _output[i] <= _lower[i]) {
+                _output[i] = _coefficients.sustainLevel;
+                enter(i, Sustain);
+            } else if (_state[i] == Release and _output[i] <= _lower[i]) {
+                _output[i] = Float(0);
+                enter(i, Idle);
+            }
+        }
+    }
+
+    auto enter(etl::size_t lane, State state) -> void
+    {
+        // Idle & Sustain hold their output (0 + x * 1) and never cross their bounds.
+        auto const& c = _coefficients;
+
+        _state[lane] = state;
+        _base[lane]  = Float(0);
+        _coef[lane]  = Float(1);
+        _lower[lane] = Float(-1);
+        _upper[lane] = Float(2);
+
+        if (state == Attack) {
+            _base[lane]  = c.attackBase;
+            _coef[lane]  = c.attackCoef;
+            _upper[lane] = Float(1);
+        } else if (state == Decay) {
+            _base[lane]  = c.decayBase;
+            _coef[lane]  = c.decayCoef;
+            _lower[lane] = c.sustainLevel;
+        } else if (state == Release) {
+            _base[lane]  = c.releaseBase;
+            _coef[lane]  = c.releaseCoef;
+            _lower[lane] = Float(0);
+        }
+    }
+
+    auto update() -> void
+    {
+        // Reuse the scalar coefficient math.
+        auto scalar = EnvelopeADSR<Float>{};
+        scalar.setSampleRate(_sampleRate);
+        scalar.setParameter(_parameter);
+        _coefficients = scalar.coefficients();
+
+        for (auto i = etl::size_t(0); i < Lanes; ++i) {
+            enter(i, _state[i]);
+        }
+    }
+
+    Parameter _parameter{};
+    Float _sampleRate{};
+    typename EnvelopeADSR<Float>::Coefficients _coefficients{};
+
+    Frame _output{};
+    Frame _base{};
+    Frame _coef{};
+    Frame _lower{};
+    Frame _upper{};
+    etl::array<State, Lanes> _state{};
+};
+
+}  // namespace grit
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <grit/audio/batch/batch.hpp>
+#include <grit/audio/oscillator/oscillator.hpp>
+#include <grit/audio/oscillator/wavetable_oscillator.hpp>
+#include <grit/math/buffer_interpolation.hpp>
+
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/concepts.hpp>
+#include <etl/mdspan.hpp>
+
+namespace grit {
+
+/// \brief Oscillator for Lanes voices. Shape is shared, phase & frequency are per lane.
+/// \ingroup grit-audio-batch
+template<etl::floating_point Float, etl::size_t Lanes>
+struct Batch<Oscillator<Float>, Lanes>
+{
+    using SampleType = Float;
+    using Frame      = etl::array<Float, Lanes>;
+
+    Batch() = default;
+
+    [[nodiscard]] static constexpr auto lanes() -> etl::size_t { return Lanes; }
+
+    auto setShape(OscillatorShape shape) -> void { _shape = shape; }
+
+    auto setPulseWidth(Float width) -> void { _pulseWidth = etl::clamp(width, Float{0}, Float{1}); }
+
+    auto setSampleRate(Float sampleRate) -> void { _sampleRate = sampleRate; }
+
+    auto setPhase(etl::size_t lane, Float phase) -> void { _phase[lane] = phase; }
+
+    auto setFrequency(etl::size_t lane, Float frequency) -> void
+    {
+        _phaseIncrement[lane] = 1.0F / (_sampleRate / frequency);
+    }
+
+    auto addPhaseOffset(Frame const& offset) -> void
+    {
+        for (auto i = etl::size_t(0); i < Lanes; ++i) {
+            _phase[i] += offset[i];
+            _phase[i] -= etl::floor(_phase[i]);
+        }
+    }
+
+    [[nodiscard]] auto operator()() -> Frame
+    {
+        using Shapes = Oscillator<Float>;
+
+        auto output = Frame{};
+        switch (_shape) {
+            case OscillatorShape::Sine: {
+                for (auto i = etl::size_t(0); i < Lanes; ++i) {
+                    output[i] = Shapes::sine(_phase[i]);
+                }
+                break;
+            }
+            case OscillatorShape::Triangle: {
+                for (auto i = etl::size_t(0); i < Lanes; ++i) {
+                    output[i] = Shapes::triangle(_phase[i], _phaseIncrement[i]);
+                }
+                break;
+            }
+            case OscillatorShape::Square: {
+                for (auto i = etl::size_t(0); i < Lanes; ++i) {
+                    output[i] = Shapes::pulse(_phase[i], _pulseWidth, _phaseIncrement[i]);
+                }
+                break;
+            }
+            case OscillatorShape::Sawtooth: {
+                for (auto i = etl::size_t(0); i < Lanes; ++i) {
+                    output[i] = Shapes::sawtooth(_phase[i], _phaseIncrement[i]);
+                }
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+
+        addPhaseOffset(_phaseIncrement);
+        return output;
+    }
+
+private:
+    OscillatorShape _shape{OscillatorShape::Sine};
+    Float _sampleRate{0};
+    Float _pulseWidth{0.5};
+    Frame _phase{};
+    Frame _phaseIncrement{};
+};
+
+/// \brief WavetableOscillator for Lanes voices sharing one wavetable.
+/// \ingroup grit-audio-batch
+template<etl::floating_point Float, etl::size_t TableSize, etl::size_t Lanes>
+struct Batch<WavetableOscillator<Float, TableSize>, Lanes>
+{
+    using SampleType = Float;
+    using Frame      = etl::array<Float, Lanes>;
+    using Wavetable  = etl::mdspan<Float const, etl::extents<etl::size_t, TableSize>>;
+
+    explicit Batch(Wavetable wavetable) : _wavetable{wavetable} {}
+
+    [[nodiscard]] static constexpr auto lanes() -> etl::size_t { return Lanes; }
+
+    auto setSampleRate(Float sampleRate) -> void { _sampleRate = sampleRate; }
+
+    auto setPhase(etl::size_t lane, Float phase) -> void { _phase[lane] = phase; }
+
+    auto setFrequency(etl::size_t lane, Float frequency) -> void
+    {
+        _phaseIncrement[lane] = 1.0F / (_sampleRate / frequency);
+    }
+
+    auto addPhaseOffset(Frame const& offset) -> void
+    {
+        for (auto i = etl::size_t(0); i < Lanes; ++i) {
+            _phase[i] += offset[i];
+            _phase[i] -= etl::floor(_phase[i]);
+        }
+    }
+
+    [[nodiscard]] auto operator()() -> Frame
+    {
+        auto output = Frame{};
+        if (_wavetable.empty()) {
+            return output;
+        }
+
+        auto const size = static_cast<Float>(_wavetable.size());
+        for (auto i = etl::size_t(0); i < Lanes; ++i) {
+            auto const scaledPhase  = _phase[i] * size;
+            auto const sampleIndex  = static_cast<etl::size_t>(scaledPhase);
+            auto const sampleOffset = scaledPhase - static_cast<Float>(sampleIndex);
+            output[i]               = BufferInterpolation::Hermite{}(_wavetable, sampleIndex, sampleOffset);
+        }
+
+        addPhaseOffset(_phaseIncrement);
+        return output;
+    }
+
+private:
+    Float _sampleRate{0};
+    Frame _phase{};
+    Frame _phaseIncrement{};
+    Wavetable _wavetable;
+};
+
+}  // namespace grit
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <grit/audio/batch/batch.hpp>
+#include <grit/audio/filter/state_variable_filter.hpp>
+
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/concepts.hpp>
+#include <etl/numbers.hpp>
+#include <etl/type_traits.hpp>
+
+namespace grit {
+
+/// \brief StateVariableFilter for Lanes voices with per-lane cutoff & resonance.
+/// \ingroup grit-audio-batch
+template<etl::floating_point Float, StateVariableFilterType Type, etl::size_t Lanes>
+struct Batch<StateVariableFilter<Float, Type>, Lanes>
+{
+    using SampleType = Float;
+    using Frame      = etl::array<Float, Lanes>;
+    using Parameter  = typename StateVariableFilter<Float, Type>::Parameter;
+
+    Batch() = default;
+
+    [[nodiscard]] static constexpr auto lanes() -> etl::size_t { return Lanes; }
+
+    auto setParameter(etl::size_t lane, Parameter const& parameter) -> void
+    {
+        _parameter[lane] = parameter;
+        update(lane);
+    }
+
+    auto setSampleRate(Float sampleRate) -> void
+    {
+        _sampleRate = sampleRate;
+        for (auto i = etl::size_t(0); i < Lanes; ++i) {
+            update(i);
+        }
+        reset();
+    }
+
+    auto reset() -> void
+    {
+        _ic1eq.fill(Float(0));
+        _ic2eq.fill(Float(0));
+    }
+
+    [[nodiscard]] auto operator()(Frame const& x) -> Frame
+    {
+        auto output = Frame{};
+        for (auto i = etl::size_t(0); i < Lanes; ++i) {
+            auto const t0 = x[i] - _ic2eq[i];
+            auto const v0 = _gt0[i] * t0 - _gk0[i] * _ic1eq[i];
+            auto const t1 = _g[i] * v0;
+            auto const v1 = _ic1eq[i] + t1;
+            auto const t2 = _g[i] * v1;
+            auto const v2 = _ic2eq[i] + t2;
+
+            _ic1eq[i] = v1 + t1;
+            _ic2eq[i] = v2 + t2;
+
+            if constexpr (Type == StateVariableFilterType::Highpass) {
+                output[i] = v0;
+            } else if constexpr (Type == StateVariableFilterType::Bandpass) {
+                output[i] = v1;
+            } else if constexpr (Type == StateVariableFilterType::Lowpass) {
+                output[i] = v2;
+            } else if constexpr (Type == StateVariableFilterType::Notch) {
+                output[i] = v0 + v2;
+            } else if constexpr (Type == StateVariableFilterType::Peak) {
+                output[i] = v0 - v2;
+            } else if constexpr (Type == StateVariableFilterType::Allpass) {
+                output[i] = v0 - _k[i] * v1 + v2;
+            } else {
+                static_assert(etl::always_false<decltype(Type)>);
+            }
+        }
+        return output;
+    }
+
+private:
+    auto update(etl::size_t lane) -> void
+    {
+        auto const& parameter = _parameter[lane];
+
+        auto w   = static_cast<Float>(etl::numbers::pi) * parameter.cutoff / _sampleRate;
+        _g[lane] = etl::tan(w);
+        _k[lane] = 1 / parameter.resonance;
+
+        auto gk    = _g[lane] + _k[lane];
+        _gt0[lane] = 1 / (1 + _g[lane] * gk);
+        _gk0[lane] = gk * _gt0[lane];
+    }
+
+    Float _sampleRate{0};
+    etl::array<Parameter, Lanes> _parameter{};
+
+    Frame _g{};
+    Frame _k{};
+    Frame _gt0{};
+    Frame _gk0{};
+
+    Frame _ic1eq{};
+    Frame _ic2eq{};
+};
+
+}  // namespace grit
@@ -0,0 +1,206 @@
+#include "batch_dynamic_smoothing.hpp"
+#include "batch_envelope_adsr.hpp"
+#include "batch_oscillator.hpp"
+#include "batch_state_variable_filter.hpp"
+
+#include <etl/array.hpp>
+#include <etl/random.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+namespace {
+
+inline constexpr auto numLanes = etl::size_t(8);
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("audio/batch: Batch<Oscillator>", "", float, double)
+{
+    using Float = TestType;
+
+    auto scalar = etl::array<grit::Oscillator<Float>, numLanes>{};
+    auto batch  = grit::Batch<grit::Oscillator<Float>, numLanes>{};
+    STATIC_REQUIRE(decltype(batch)::lanes() == numLanes);
+
+    auto const shape = GENERATE(
+        grit::OscillatorShape::Sine,
+        grit::OscillatorShape::Triangle,
+        grit::OscillatorShape::Square,
+        grit::OscillatorShape::Sawtooth
+    );
+
+    batch.setShape(shape);
+    batch.setPulseWidth(Float(0.3));
+    batch.setSampleRate(Float(48'000));
+    for (auto lane = etl::size_t(0); lane < numLanes; ++lane) {
+        auto const frequency = Float(110) * static_cast<Float>(lane + 1);
+        auto const phase     = static_cast<Float>(lane) / static_cast<Float>(numLanes);
+
+        scalar[lane].setShape(shape);
+        scalar[lane].setPulseWidth(Float(0.3));
+        scalar[lane].setSampleRate(Float(48'000));
+        scalar[lane].setFrequency(frequency);
+        scalar[lane].setPhase(phase);
+
+        batch.setFrequency(lane, frequency);
+        batch.setPhase(lane, phase);
+    }
+
+    for (auto i{0}; i < 1'000; ++i) {
+        auto const out = batch();
+        for (auto lane = etl::size_t(0); lane < numLanes; ++lane) {
+            REQUIRE(out[lane] == scalar[lane]());
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/batch: Batch<WavetableOscillator>", "", float, double)
+{
+    using Float = TestType;
+
+    static constexpr auto sine      = grit::makeSineWavetable<Float, 512>();
+    static constexpr auto wavetable = etl::mdspan{sine.data(), etl::extents<etl::size_t, sine.size()>{}};
+
+    using Oscillator = grit::WavetableOscillator<Float, sine.size()>;
+
+    auto scalar = etl::array<Oscillator, numLanes>{
+        Oscillator{wavetable},
+        Oscillator{wavetable},
+        Oscillator{wavetable},
+        Oscillator{wavetable},
+        Oscillator{wavetable},
+        Oscillator{wavetable},
+        Oscillator{wavetable},
+        Oscillator{wavetable},
+    };
+    auto batch = grit::Batch<Oscillator, numLanes>{wavetable};
+
+    batch.setSampleRate(Float(48'000));
+    for (auto lane = etl::size_t(0); lane < numLanes; ++lane) {
+        auto const frequency = Float(55) * static_cast<Float>(lane + 1);
+        scalar[lane].setSampleRate(Float(48'000));
+        scalar[lane].setFrequency(frequency);
+        batch.setFrequency(lane, frequency);
+    }
+
+    for (auto i{0}; i < 1'000; ++i) {
+        auto const out = batch();
+        for (auto lane = etl::size_t(0); lane < numLanes; ++lane) {
+            REQUIRE(out[lane] == Catch::Approx(scalar[lane]()).margin(1e-6));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/batch: Batch<EnvelopeADSR>", "", float, double)
+{
+    using Float = TestType;
+
+    auto const parameter = typename grit::EnvelopeADSR<Float>::Parameter{
+        .attack  = grit::Milliseconds<Float>{2},
+        .decay   = grit::Milliseconds<Float>{5},
+        .sustain = Float(0.5),
+        .release = grit::Milliseconds<Float>{10},
+    };
+
+    auto scalar = etl::array<grit::EnvelopeADSR<Float>, numLanes>{};
+    auto batch  = grit::Batch<grit::EnvelopeADSR<Float>, numLanes>{};
+
+    batch.setSampleRate(Float(48'000));
+    batch.setParameter(parameter);
+    for (auto& envelope : scalar) {
+        envelope.setSampleRate(Float(48'000));
+        envelope.setParameter(parameter);
+    }
+
+    for (auto i = etl::size_t(0); i < 4'000; ++i) {
+        // Staggered gates, every lane goes through all stages at a different time.
+        for (auto lane = etl::size_t(0); lane < numLanes; ++lane) {
+            if (i == lane * 100) {
+                scalar[lane].gate(true);
+                batch.gate(lane, true);
+            }
+            if (i == 1'000 + lane * 150) {
+                scalar[lane].gate(false);
+                batch.gate(lane, false);
+            }
+        }
+
+        auto const out = batch();
+        for (auto lane = etl::size_t(0); lane < numLanes; ++lane) {
+            REQUIRE(out[lane] == Catch::Approx(scalar[lane]()).margin(1e-6));
+        }
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "audio/batch: Batch<StateVariableFilter>",
+    "",
+    (grit::StateVariableHighpass,
+     grit::StateVariableBandpass,
+     grit::StateVariableLowpass,
+     grit::StateVariableNotch,
+     grit::StateVariablePeak,
+     grit::StateVariableAllpass),
+    (float, double)
+)
+{
+    using Filter = TestType;
+    using Float  = typename Filter::SampleType;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(1)};
+
+    auto scalar = etl::array<Filter, numLanes>{};
+    auto batch  = grit::Batch<Filter, numLanes>{};
+
+    batch.setSampleRate(Float(48'000));
+    for (auto lane = etl::size_t(0); lane < numLanes; ++lane) {
+        auto const parameter = typename Filter::Parameter{
+            .cutoff    = Float(200) * static_cast<Float>(lane + 1),
+            .resonance = Float(0.5) + static_cast<Float>(lane) * Float(0.25),
+        };
+
+        scalar[lane].setSampleRate(Float(48'000));
+        scalar[lane].setParameter(parameter);
+        batch.setParameter(lane, parameter);
+    }
+
+    for (auto i{0}; i < 1'000; ++i) {
+        auto x = typename decltype(batch)::Frame{};
+        etl::generate(x.begin(), x.end(), [&] { return dist(rng); });
+
+        auto const out = batch(x);
+        for (auto lane = etl::size_t(0); lane < numLanes; ++lane) {
+            REQUIRE(out[lane] == Catch::Approx(scalar[lane](x[lane])).margin(1e-6));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/batch: Batch<DynamicSmoothing>", "", float, double)
+{
+    using Float = TestType;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(0), Float(1)};
+
+    auto scalar = etl::array<grit::DynamicSmoothing<Float>, numLanes>{};
+    auto batch  = grit::Batch<grit::DynamicSmoothing<Float>, numLanes>{};
+
+    batch.setSampleRate(Float(1'500));
+    for (auto& smoothing : scalar) {
+        smoothing.setSampleRate(Float(1'500));
+    }
+
+    for (auto i{0}; i < 1'000; ++i) {
+        auto x = typename decltype(batch)::Frame{};
+        etl::generate(x.begin(), x.end(), [&] { return dist(rng); });
+
+        auto const out = batch(x);
+        for (auto lane = etl::size_t(0); lane < numLanes; ++lane) {
+            REQUIRE(out[lane] == Catch::Approx(scalar[lane](x[lane])).margin(1e-6));
+        }
+    }
+}
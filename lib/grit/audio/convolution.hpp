@@ -0,0 +1,7 @@
+#pragma once
+
+/// \defgroup grit-audio-convolution Convolution
+/// \ingroup grit-audio
+
+#include <grit/audio/convolution/non_uniform_convolver.hpp>
+#include <grit/audio/convolution/uniform_convolver.hpp>
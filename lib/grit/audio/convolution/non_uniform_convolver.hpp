@@ -0,0 +1,200 @@
+#pragma once
+
+#include <grit/audio/convolution/uniform_convolver.hpp>
+#include <grit/fft/bit_reversed_plan.hpp>
+#include <grit/fft/real_plan.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/complex.hpp>
+#include <etl/concepts.hpp>
+#include <etl/cstddef.hpp>
+#include <etl/mdspan.hpp>
+#include <etl/span.hpp>
+
+namespace grit {
+
+/// \brief Two level non-uniformly partitioned convolution.
+///
+/// \details The first 2*TailBlockSize samples of the impulse response run on
+/// a UniformConvolver with BlockSize partitions. The rest is partitioned into
+/// TailBlockSize blocks. The tail work for one TailBlockSize block (forward
+/// fft, one multiply accumulate per partition, backward fft) is split into
+/// work units and spread evenly over the TailBlockSize/BlockSize callbacks it
+/// takes to collect the next block. The tail result is played back
+/// 2*TailBlockSize samples late, which is exactly where the tail starts in
+/// the impulse response. Zero latency overall, the per-callback cost is
+/// deterministic and doesn't depend on the callback count. The work units are
+/// stepped from process().
+///
+/// \ingroup grit-audio-convolution
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t TailBlockSize, etl::size_t TailPartitions>
+struct NonUniformConvolver
+{
+    static_assert(TailBlockSize % BlockSize == 0);
+    static_assert(TailBlockSize >= BlockSize * 2);
+
+    using SampleType  = Float;
+    using ComplexType = etl::complex<Float>;
+
+    NonUniformConvolver() = default;
+
+    [[nodiscard]] static constexpr auto blockSize() -> etl::size_t { return BlockSize; }
+
+    [[nodiscard]] static constexpr auto tailBlockSize() -> etl::size_t { return TailBlockSize; }
+
+    [[nodiscard]] static constexpr auto maxImpulseResponseSize() -> etl::size_t
+    {
+        return headSize + TailBlockSize * TailPartitions;
+    }
+
+    /// Transforms the impulse response into partitions. Doesn't allocate, but
+    /// runs one fft per partition, so don't call it on every block.
+    /// \pre ir.size() <= maxImpulseResponseSize()
+    auto setImpulseResponse(etl::span<Float const> ir) -> void;
+
+    /// Processes a single block.
+    /// \pre input.size() == output.size() == blockSize(), input & output may alias
+    auto process(etl::span<Float const> input, etl::span<Float> output) -> void;
+
+    auto reset() -> void;
+
+private:
+    static constexpr auto headSize  = TailBlockSize * 2;
+    static constexpr auto fftSize   = TailBlockSize * 2;
+    static constexpr auto numSlices = TailBlockSize / BlockSize;
+
+    using Head     = UniformConvolver<Float, BlockSize, headSize / BlockSize>;
+    using Plan     = fft::RealPlan<Float, fftSize>;
+    using Spectrum = etl::mdspan<ComplexType, etl::extents<etl::size_t, Plan::numBins()>>;
+    using Samples  = etl::mdspan<Float, etl::extents<etl::size_t, fftSize>>;
+
+    /// Unit 0 is the forward fft, 1 to N the partitions, N+1 the backward fft.
+    auto runTailUnit(etl::size_t unit) -> void;
+
+    [[nodiscard]] auto filter(etl::size_t partition) -> Spectrum;
+    [[nodiscard]] auto delayLine(etl::size_t slot) -> Spectrum;
+
+    Head _head{};
+
+    Plan _plan{};
+    etl::array<Float, TailBlockSize> _collect{};
+    etl::array<Float, TailBlockSize> _playback{};
+    etl::array<Float, fftSize> _input{};
+    etl::array<Float, fftSize> _output{};
+    etl::array<ComplexType, Plan::numBins()> _accumulator{};
+    etl::array<ComplexType, Plan::numBins() * TailPartitions> _filter{};
+    etl::array<ComplexType, Plan::numBins() * TailPartitions> _delayLine{};
+    etl::size_t _numPartitions{0};
+    etl::size_t _delayHead{0};
+    etl::size_t _slot{0};
+    etl::size_t _slice{0};
+};
+
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t TailBlockSize, etl::size_t TailPartitions>
+auto NonUniformConvolver<Float, BlockSize, TailBlockSize, TailPartitions>::setImpulseResponse(
+    etl::span<Float const> ir
+) -> void
+{
+    _head.setImpulseResponse(ir.first(etl::min(headSize, ir.size())));
+
+    auto const tail = ir.size() > headSize ? ir.subspan(headSize) : etl::span<Float const>{};
+    _numPartitions  = (tail.size() + TailBlockSize - 1) / TailBlockSize;
+
+    // The backward fft is unnormalized, fold the 1/N into the partitions.
+    auto const scale = Float(1) / Float(fftSize);
+
+    for (auto p = etl::size_t(0); p < _numPartitions; ++p) {
+        auto const offset    = p * TailBlockSize;
+        auto const partition = tail.subspan(offset, etl::min(TailBlockSize, tail.size() - offset));
+
+        etl::fill(_output.begin(), _output.end(), Float(0));
+        etl::transform(partition.begin(), partition.end(), _output.begin(), [scale](auto x) { return x * scale; });
+
+        _plan(Samples{_output.data()}, filter(p));
+    }
+
+    etl::fill(_output.begin(), _output.end(), Float(0));
+}
+
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t TailBlockSize, etl::size_t TailPartitions>
+auto NonUniformConvolver<Float, BlockSize, TailBlockSize, TailPartitions>::process(
+    etl::span<Float const> input,
+    etl::span<Float> output
+) -> void
+{
+    auto const offset = _slice * BlockSize;
+    etl::copy(input.begin(), input.end(), _collect.begin() + offset);
+
+    _head.process(input, output);
+    for (auto i = etl::size_t(0); i < BlockSize; ++i) {
+        output[i] += _playback[offset + i];
+    }
+
+    if (_numPartitions != 0) {
+        auto const numUnits = _numPartitions + 2;
+        auto const first    = _slice * numUnits / numSlices;
+        auto const last     = (_slice + 1) * numUnits / numSlices;
+        for (auto unit = first; unit < last; ++unit) {
+            runTailUnit(unit);
+        }
+    }
+
+    if (++_slice == numSlices) {
+        _slice = 0;
+
+        // The block finished in this period is played back in the next one.
+        etl::copy(_output.begin() + TailBlockSize, _output.end(), _playback.begin());
+
+        etl::copy(_input.begin() + TailBlockSize, _input.end(), _input.begin());
+        etl::copy(_collect.begin(), _collect.end(), _input.begin() + TailBlockSize);
+    }
+}
+
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t TailBlockSize, etl::size_t TailPartitions>
+auto NonUniformConvolver<Float, BlockSize, TailBlockSize, TailPartitions>::runTailUnit(etl::size_t unit) -> void
+{
+    auto const accumulator = Spectrum{_accumulator.data()};
+
+    if (unit == 0) {
+        _delayHead = _delayHead + 1 == TailPartitions ? 0 : _delayHead + 1;
+        _slot      = _delayHead;
+        _plan(Samples{_input.data()}, delayLine(_delayHead));
+        etl::fill(_accumulator.begin(), _accumulator.end(), ComplexType{});
+    } else if (unit <= _numPartitions) {
+        // Partition p is applied to the spectrum from p tail blocks ago.
+        fft::multiplyAccumulate(filter(unit - 1), delayLine(_slot), accumulator);
+        _slot = _slot == 0 ? TailPartitions - 1 : _slot - 1;
+    } else {
+        _plan(accumulator, Samples{_output.data()});
+    }
+}
+
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t TailBlockSize, etl::size_t TailPartitions>
+auto NonUniformConvolver<Float, BlockSize, TailBlockSize, TailPartitions>::reset() -> void
+{
+    _head.reset();
+
+    etl::fill(_collect.begin(), _collect.end(), Float(0));
+    etl::fill(_playback.begin(), _playback.end(), Float(0));
+    etl::fill(_input.begin(), _input.end(), Float(0));
+    etl::fill(_output.begin(), _output.end(), Float(0));
+    etl::fill(_delayLine.begin(), _delayLine.end(), ComplexType{});
+    _delayHead = 0;
+    _slot      = 0;
+    _slice     = 0;
+}
+
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t TailBlockSize, etl::size_t TailPartitions>
+auto NonUniformConvolver<Float, BlockSize, TailBlockSize, TailPartitions>::filter(etl::size_t partition) -> Spectrum
+{
+    return Spectrum{_filter.data() + partition * Plan::numBins()};
+}
+
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t TailBlockSize, etl::size_t TailPartitions>
+auto NonUniformConvolver<Float, BlockSize, TailBlockSize, TailPartitions>::delayLine(etl::size_t slot) -> Spectrum
+{
+    return Spectrum{_delayLine.data() + slot * Plan::numBins()};
+}
+
+}  // namespace grit
@@ -0,0 +1,70 @@
+#include "non_uniform_convolver.hpp"
+
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+template<typename Float, etl::size_t BlockSize, etl::size_t TailBlockSize, etl::size_t TailPartitions>
+auto testNonUniformConvolver(etl::size_t irSize) -> void
+{
+    using Convolver = grit::NonUniformConvolver<Float, BlockSize, TailBlockSize, TailPartitions>;
+
+    CAPTURE(BlockSize, TailBlockSize, TailPartitions, irSize);
+    REQUIRE(irSize <= Convolver::maxImpulseResponseSize());
+
+    auto const numBlocks = (irSize + TailBlockSize * 3) / BlockSize;
+    auto const numInput  = BlockSize * numBlocks;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(1)};
+
+    auto ir    = std::vector<Float>(irSize);
+    auto input = std::vector<Float>(numInput);
+    etl::generate(ir.begin(), ir.end(), [&] { return dist(rng); });
+    etl::generate(input.begin(), input.end(), [&] { return dist(rng); });
+
+    auto convolver = std::make_unique<Convolver>();
+    convolver->setImpulseResponse(etl::span<Float const>{ir.data(), ir.size()});
+
+    auto output = input;
+    for (auto b = etl::size_t(0); b < numBlocks; ++b) {
+        auto block = etl::span<Float>{output.data() + b * BlockSize, BlockSize};
+        convolver->process(block, block);
+    }
+
+    auto const tolerance = etl::same_as<Float, float> ? 1e-3 : 1e-9;
+    for (auto n = etl::size_t(0); n < numInput; ++n) {
+        auto expected = Float(0);
+        for (auto k = etl::size_t(0); k < irSize and k <= n; ++k) {
+            expected += ir[k] * input[n - k];
+        }
+
+        CAPTURE(n);
+        REQUIRE_THAT(output[n], Catch::Matchers::WithinAbs(expected, tolerance));
+    }
+
+    convolver->reset();
+    auto silence = etl::array<Float, BlockSize>{};
+    convolver->process(silence, silence);
+    for (auto x : silence) {
+        REQUIRE_THAT(x, Catch::Matchers::WithinAbs(0, tolerance));
+    }
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("audio/convolution: NonUniformConvolver", "", float, double)
+{
+    testNonUniformConvolver<TestType, 4, 8, 1>(5);
+    testNonUniformConvolver<TestType, 4, 8, 1>(24);
+    testNonUniformConvolver<TestType, 4, 16, 4>(90);
+    testNonUniformConvolver<TestType, 8, 64, 3>(300);
+    testNonUniformConvolver<TestType, 16, 128, 16>(2'000);
+}
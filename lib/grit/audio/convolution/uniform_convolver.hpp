@@ -0,0 +1,140 @@
+#pragma once
+
+#include <grit/fft/bit_reversed_plan.hpp>
+#include <grit/fft/real_plan.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/complex.hpp>
+#include <etl/concepts.hpp>
+#include <etl/cstddef.hpp>
+#include <etl/mdspan.hpp>
+#include <etl/span.hpp>
+
+namespace grit {
+
+/// \brief Uniformly partitioned overlap-save convolution.
+///
+/// \details The impulse response is split into MaxPartitions blocks of
+/// BlockSize samples. Each partition is stored as a real fft spectrum of size
+/// 2*BlockSize. Every call to process() transforms the last two input blocks,
+/// pushes the spectrum into a frequency-domain delay line and multiply
+/// accumulates it against the partitions. One forward and one backward fft per
+/// block, independent of the impulse response length. Zero latency.
+///
+/// All storage is inline, roughly 2 * MaxPartitions * (BlockSize+1) complex
+/// values.
+///
+/// \ingroup grit-audio-convolution
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t MaxPartitions>
+struct UniformConvolver
+{
+    using SampleType  = Float;
+    using ComplexType = etl::complex<Float>;
+
+    UniformConvolver() = default;
+
+    [[nodiscard]] static constexpr auto blockSize() -> etl::size_t { return BlockSize; }
+
+    [[nodiscard]] static constexpr auto maxImpulseResponseSize() -> etl::size_t { return BlockSize * MaxPartitions; }
+
+    /// Transforms the impulse response into partitions. Doesn't allocate, but
+    /// runs one fft per partition, so don't call it on every block.
+    /// \pre ir.size() <= maxImpulseResponseSize()
+    auto setImpulseResponse(etl::span<Float const> ir) -> void;
+
+    /// Processes a single block.
+    /// \pre input.size() == output.size() == blockSize(), input & output may alias
+    auto process(etl::span<Float const> input, etl::span<Float> output) -> void;
+
+    auto reset() -> void;
+
+private:
+    static constexpr auto fftSize = BlockSize * 2;
+
+    using Plan     = fft::RealPlan<Float, fftSize>;
+    using Spectrum = etl::mdspan<ComplexType, etl::extents<etl::size_t, Plan::numBins()>>;
+    using Samples  = etl::mdspan<Float, etl::extents<etl::size_t, fftSize>>;
+
+    [[nodiscard]] auto filter(etl::size_t partition) -> Spectrum;
+    [[nodiscard]] auto delayLine(etl::size_t slot) -> Spectrum;
+
+    Plan _plan{};
+    etl::array<Float, fftSize> _input{};
+    etl::array<Float, fftSize> _output{};
+    etl::array<ComplexType, Plan::numBins()> _accumulator{};
+    etl::array<ComplexType, Plan::numBins() * MaxPartitions> _filter{};
+    etl::array<ComplexType, Plan::numBins() * MaxPartitions> _delayLine{};
+    etl::size_t _numPartitions{0};
+    etl::size_t _head{0};
+};
+
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t MaxPartitions>
+auto UniformConvolver<Float, BlockSize, MaxPartitions>::setImpulseResponse(etl::span<Float const> ir) -> void
+{
+    _numPartitions = (ir.size() + BlockSize - 1) / BlockSize;
+
+    // The backward fft is unnormalized, fold the 1/N into the partitions.
+    auto const scale = Float(1) / Float(fftSize);
+
+    for (auto p = etl::size_t(0); p < _numPartitions; ++p) {
+        auto const partition = ir.subspan(p * BlockSize, etl::min(BlockSize, ir.size() - p * BlockSize));
+
+        etl::fill(_output.begin(), _output.end(), Float(0));
+        etl::transform(partition.begin(), partition.end(), _output.begin(), [scale](auto x) { return x * scale; });
+
+        _plan(Samples{_output.data()}, filter(p));
+    }
+
+    etl::fill(_output.begin(), _output.end(), Float(0));
+}
+
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t MaxPartitions>
+auto UniformConvolver<Float, BlockSize, MaxPartitions>::process(etl::span<Float const> input, etl::span<Float> output)
+    -> void
+{
+    // Sliding window over the last two blocks.
+    etl::copy(_input.begin() + BlockSize, _input.end(), _input.begin());
+    etl::copy(input.begin(), input.end(), _input.begin() + BlockSize);
+
+    _plan(Samples{_input.data()}, delayLine(_head));
+
+    auto const accumulator = Spectrum{_accumulator.data()};
+    etl::fill(_accumulator.begin(), _accumulator.end(), ComplexType{});
+
+    // Partition p is applied to the spectrum from p blocks ago.
+    auto slot = _head;
+    for (auto p = etl::size_t(0); p < _numPartitions; ++p) {
+        fft::multiplyAccumulate(filter(p), delayLine(slot), accumulator);
+        slot = slot == 0 ? MaxPartitions - 1 : slot - 1;
+    }
+
+    _plan(accumulator, Samples{_output.data()});
+    _head = _head + 1 == MaxPartitions ? 0 : _head + 1;
+
+    // The first half is circular aliasing, the second half is the linear convolution.
+    etl::copy(_output.begin() + BlockSize, _output.end(), output.begin());
+}
+
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t MaxPartitions>
+auto UniformConvolver<Float, BlockSize, MaxPartitions>::reset() -> void
+{
+    etl::fill(_input.begin(), _input.end(), Float(0));
+    etl::fill(_output.begin(), _output.end(), Float(0));
+    etl::fill(_delayLine.begin(), _delayLine.end(), ComplexType{});
+    _head = 0;
+}
+
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t MaxPartitions>
+auto UniformConvolver<Float, BlockSize, MaxPartitions>::filter(etl::size_t partition) -> Spectrum
+{
+    return Spectrum{_filter.data() + partition * Plan::numBins()};
+}
+
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t MaxPartitions>
+auto UniformConvolver<Float, BlockSize, MaxPartitions>::delayLine(etl::size_t slot) -> Spectrum
+{
+    return Spectrum{_delayLine.data() + slot * Plan::numBins()};
+}
+
+}  // namespace grit
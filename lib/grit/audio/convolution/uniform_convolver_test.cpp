@@ -0,0 +1,62 @@
+#include "uniform_convolver.hpp"
+
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+namespace {
+
+template<typename Float, etl::size_t BlockSize, etl::size_t MaxPartitions, etl::size_t IrSize>
+auto testUniformConvolver() -> void
+{
+    static constexpr auto numBlocks = MaxPartitions + 3;
+    static constexpr auto numInput  = BlockSize * numBlocks;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(1)};
+
+    auto ir    = etl::array<Float, IrSize>{};
+    auto input = etl::array<Float, numInput>{};
+    etl::generate(ir.begin(), ir.end(), [&] { return dist(rng); });
+    etl::generate(input.begin(), input.end(), [&] { return dist(rng); });
+
+    auto convolver = grit::UniformConvolver<Float, BlockSize, MaxPartitions>{};
+    convolver.setImpulseResponse(ir);
+
+    auto output = input;
+    for (auto b = etl::size_t(0); b < numBlocks; ++b) {
+        auto block = etl::span<Float>{output}.subspan(b * BlockSize, BlockSize);
+        convolver.process(block, block);
+    }
+
+    auto const tolerance = etl::same_as<Float, float> ? 1e-3 : 1e-9;
+    for (auto n = etl::size_t(0); n < numInput; ++n) {
+        auto expected = Float(0);
+        for (auto k = etl::size_t(0); k < IrSize and k <= n; ++k) {
+            expected += ir[k] * input[n - k];
+        }
+
+        CAPTURE(n);
+        REQUIRE_THAT(output[n], Catch::Matchers::WithinAbs(expected, tolerance));
+    }
+
+    convolver.reset();
+    auto silence = etl::array<Float, BlockSize>{};
+    convolver.process(silence, silence);
+    for (auto x : silence) {
+        REQUIRE_THAT(x, Catch::Matchers::WithinAbs(0, tolerance));
+    }
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("audio/convolution: UniformConvolver", "", float, double)
+{
+    testUniformConvolver<TestType, 4, 1, 1>();
+    testUniformConvolver<TestType, 4, 1, 4>();
+    testUniformConvolver<TestType, 16, 4, 64>();
+    testUniformConvolver<TestType, 16, 8, 37>();
+    testUniformConvolver<TestType, 32, 16, 500>();
+}
@@ -3,5 +3,7 @@
 /// \defgroup grit-audio-delay Delay
 /// \ingroup grit-audio
 
+#include <grit/audio/delay/block_delay_line.hpp>
+#include <grit/audio/delay/multi_tap_delay.hpp>
 #include <grit/audio/delay/non_owning_delay_line.hpp>
 #include <grit/audio/delay/static_delay_line.hpp>
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <grit/math/buffer_interpolation.hpp>
+#include <grit/math/fixed_point.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/concepts.hpp>
+#include <etl/cstdint.hpp>
+#include <etl/mdspan.hpp>
+#include <etl/span.hpp>
+#include <etl/type_traits.hpp>
+
+namespace grit {
+
+/// \brief Delay line for buffers in slow external memory, e.g. the SDRAM of the Daisy.
+///
+/// \details Only touches the buffer with contiguous block sized copies. Every
+/// block is written in one go, then the span of history all of the block's
+/// reads fall into is copied to an on-chip scratch buffer and interpolated
+/// from there. A wrap around the end of the buffer splits a copy in two, so
+/// there are at most four runs of sequential accesses per block instead of
+/// a random read per sample.
+///
+/// Allocate the buffer from a MemoryArena over a TA_SDRAM_BSS array on the
+/// hardware, or heap memory on the host. setDelay() takes effect over the
+/// next block as a linear ramp. The ramp is limited to one sample of delay
+/// per sample, larger jumps are spread over multiple blocks.
+///
+/// Storage is either Float or etl::int16_t for raw Q15 samples, which halves
+/// the memory & bandwidth of the buffer. The samples are converted on the
+/// block copies, the scratch buffer & the interpolation stay in Float.
+///
+/// \ingroup grit-audio-delay
+template<
+    etl::floating_point Float,
+    etl::size_t MaxBlockSize,
+    typename Interpolation = BufferInterpolation::GuardedHermite,
+    typename Storage       = Float>
+struct BlockDelayLine
+{
+    static_assert(MaxBlockSize >= 1);
+    static_assert(bufferGuardPoints<Interpolation> == 3, "needs a non wrapping interpolation");
+    static_assert(etl::is_same_v<Storage, Float> or etl::is_same_v<Storage, etl::int16_t>);
+
+    using SampleType  = Float;
+    using StorageType = Storage;
+    using Buffer      = etl::mdspan<Storage, etl::dextents<etl::size_t, 1>>;
+
+    /// \pre buffer.extent(0) >= MaxBlockSize + 3
+    explicit BlockDelayLine(Buffer buffer);
+
+    [[nodiscard]] static constexpr auto maxBlockSize() -> etl::size_t { return MaxBlockSize; }
+
+    /// Delays are clamped to [minDelay(), maxDelay()] samples.
+    [[nodiscard]] static constexpr auto minDelay() -> Float { return Float(2); }
+
+    [[nodiscard]] auto maxDelay() const -> Float;
+
+    auto setDelay(Float delayInSamples) -> void;
+
+    /// Clears the buffer and jumps to the target delay.
+    auto reset() -> void;
+
+    /// \pre input.size() == output.size() <= MaxBlockSize, input & output may alias
+    auto process(etl::span<Float const> input, etl::span<Float> output) -> void;
+
+private:
+    auto write(etl::span<Float const> input) -> void;
+    auto read(etl::size_t first, etl::size_t count) -> void;
+
+    [[nodiscard]] static auto store(Float x) -> Storage;
+    [[nodiscard]] static auto load(Storage x) -> Float;
+
+    Buffer _buffer;
+    TETL_NO_UNIQUE_ADDRESS Interpolation _interpolator{};
+
+    Float _target{2};
+    Float _delay{2};
+    etl::size_t _writePos{0};
+    etl::array<Float, MaxBlockSize * 2 + 4> _scratch{};
+};
+
+/// \brief BlockDelayLine with a Q15 buffer.
+/// \ingroup grit-audio-delay
+template<
+    etl::floating_point Float,
+    etl::size_t MaxBlockSize,
+    typename Interpolation = BufferInterpolation::GuardedHermite>
+using BlockDelayLineQ15 = BlockDelayLine<Float, MaxBlockSize, Interpolation, etl::int16_t>;
+
+template<etl::floating_point Float, etl::size_t MaxBlockSize, typename Interpolation, typename Storage>
+BlockDelayLine<Float, MaxBlockSize, Interpolation, Storage>::BlockDelayLine(Buffer buffer) : _buffer{buffer}
+{}
+
+template<etl::floating_point Float, etl::size_t MaxBlockSize, typename Interpolation, typename Storage>
+auto BlockDelayLine<Float, MaxBlockSize, Interpolation, Storage>::maxDelay() const -> Float
+{
+    return static_cast<Float>(_buffer.extent(0) - MaxBlockSize - 1);
+}
+
+template<etl::floating_point Float, etl::size_t MaxBlockSize, typename Interpolation, typename Storage>
+auto BlockDelayLine<Float, MaxBlockSize, Interpolation, Storage>::setDelay(Float delayInSamples) -> void
+{
+    _target = etl::clamp(delayInSamples, minDelay(), maxDelay());
+}
+
+template<etl::floating_point Float, etl::size_t MaxBlockSize, typename Interpolation, typename Storage>
+auto BlockDelayLine<Float, MaxBlockSize, Interpolation, Storage>::reset() -> void
+{
+    etl::fill_n(_buffer.data_handle(), _buffer.extent(0), Storage(0));
+    _delay    = _target;
+    _writePos = 0;
+}
+
+template<etl::floating_point Float, etl::size_t MaxBlockSize, typename Interpolation, typename Storage>
+auto BlockDelayLine<Float, MaxBlockSize, Interpolation, Storage>::process(
+    etl::span<Float const> input,
+    etl::span<Float> output
+) -> void
+{
+    if (input.empty()) {
+        return;
+    }
+
+    auto const size  = input.size();
+    auto const n     = static_cast<Float>(size);
+    auto const start = _delay;
+    auto const end   = etl::clamp(_target, start - n, start + n);
+    auto const step  = (end - start) / n;
+
+    // The write position is the first sample of this block, the oldest read
+    // lands at least one sample after back ago, which leaves room for the
+    // interpolation's first point.
+    auto const shortest = etl::min(start, end);
+    auto const back     = static_cast<etl::size_t>(etl::ceil(etl::max(start, end))) + 1;
+    auto const count    = static_cast<etl::size_t>(static_cast<Float>(size - 1 + back) - shortest) + 3;
+
+    write(input);
+    read(_writePos + _buffer.extent(0) - back, count);
+
+    auto const scratch = etl::mdspan{_scratch.data(), etl::dextents<etl::size_t, 1>{count}};
+    for (auto i = etl::size_t(0); i < size; ++i) {
+        auto const delay = start + step * static_cast<Float>(i + 1);
+        auto const pos   = static_cast<Float>(i + back) - delay;
+        auto const whole = static_cast<etl::size_t>(pos);
+        auto const frac  = pos - static_cast<Float>(whole);
+        output[i]        = _interpolator(scratch, whole - 1, frac);
+    }
+
+    _delay    = end;
+    _writePos = _writePos + size >= _buffer.extent(0) ? _writePos + size - _buffer.extent(0) : _writePos + size;
+}
+
+template<etl::floating_point Float, etl::size_t MaxBlockSize, typename Interpolation, typename Storage>
+auto BlockDelayLine<Float, MaxBlockSize, Interpolation, Storage>::write(etl::span<Float const> input) -> void
+{
+    auto const head = etl::min(input.size(), _buffer.extent(0) - _writePos);
+    etl::transform(input.begin(), input.begin() + head, _buffer.data_handle() + _writePos, store);
+    etl::transform(input.begin() + head, input.end(), _buffer.data_handle(), store);
+}
+
+template<etl::floating_point Float, etl::size_t MaxBlockSize, typename Interpolation, typename Storage>
+auto BlockDelayLine<Float, MaxBlockSize, Interpolation, Storage>::read(etl::size_t first, etl::size_t count) -> void
+{
+    // first is below twice the size, a single subtraction wraps it.
+    auto const size  = _buffer.extent(0);
+    auto const begin = first >= size ? first - size : first;
+    auto const head  = etl::min(count, size - begin);
+
+    auto const* const data = _buffer.data_handle();
+    etl::transform(data + begin, data + begin + head, _scratch.begin(), load);
+    etl::transform(data, data + (count - head), _scratch.begin() + head, load);
+}
+
+template<etl::floating_point Float, etl::size_t MaxBlockSize, typename Interpolation, typename Storage>
+auto BlockDelayLine<Float, MaxBlockSize, Interpolation, Storage>::store(Float x) -> Storage
+{
+    if constexpr (etl::is_same_v<Storage, Float>) {
+        return x;
+    } else {
+        return Q15::fromFloat(x).raw();
+    }
+}
+
+template<etl::floating_point Float, etl::size_t MaxBlockSize, typename Interpolation, typename Storage>
+auto BlockDelayLine<Float, MaxBlockSize, Interpolation, Storage>::load(Storage x) -> Float
+{
+    if constexpr (etl::is_same_v<Storage, Float>) {
+        return x;
+    } else {
+        return Q15::fromRaw(x).template toFloat<Float>();
+    }
+}
+
+}  // namespace grit
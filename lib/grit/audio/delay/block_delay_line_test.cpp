@@ -0,0 +1,155 @@
+#include "block_delay_line.hpp"
+
+#include <grit/core/memory_arena.hpp>
+#include <grit/math/hermite_interpolation.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/cmath.hpp>
+#include <etl/cstddef.hpp>
+#include <etl/cstdint.hpp>
+#include <etl/span.hpp>
+#include <etl/type_traits.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <vector>
+
+namespace {
+
+// Hermite read of the full input history at a fractional position, zeros before the start.
+template<typename Float>
+[[nodiscard]] auto reference(std::vector<Float> const& history, Float position) -> Float
+{
+    auto const at = [&](auto index) {
+        return index < 0 or index >= std::ssize(history) ? Float(0) : history[static_cast<std::size_t>(index)];
+    };
+
+    auto const whole = static_cast<std::ptrdiff_t>(etl::floor(position));
+    auto const frac  = position - etl::floor(position);
+    return grit::hermiteInterpolation(at(whole - 1), at(whole), at(whole + 1), at(whole + 2), frac);
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("audio/delay: BlockDelayLine", "", float, double)
+{
+    using Float = TestType;
+    using Delay = grit::BlockDelayLine<Float, 16>;
+
+    STATIC_REQUIRE(Delay::maxBlockSize() == 16);
+
+    // The buffer comes from an arena on the heap, like the SDRAM on hardware.
+    auto memory = std::vector<etl::byte>(4096);
+    auto arena  = grit::MemoryArena{memory};
+    auto buffer = arena.allocate<Float>(500);
+    REQUIRE(buffer.size() == 500);
+
+    auto delay = Delay{etl::mdspan{buffer.data(), etl::dextents<etl::size_t, 1>{buffer.size()}}};
+    REQUIRE(delay.maxDelay() == Catch::Approx(483));
+
+    auto const delayInSamples = GENERATE(Float(2), Float(7), Float(7.5), Float(64.25), Float(483), Float(10'000));
+    delay.setDelay(delayInSamples);
+    delay.reset();
+
+    auto const expectedDelay = etl::clamp(delayInSamples, Float(2), Float(483));
+
+    // Blocks of varying size, processed in place, wrap around the buffer multiple times.
+    auto history = std::vector<Float>{};
+    auto block   = std::vector<Float>(16);
+    for (auto b = 0; b < 200; ++b) {
+        auto const size = static_cast<std::size_t>(1 + (b * 7) % 16);
+        block.resize(size);
+        for (auto& sample : block) {
+            sample = etl::sin(Float(0.05) * static_cast<Float>(history.size()));
+            history.push_back(sample);
+        }
+
+        delay.process(block, block);
+
+        for (auto i = std::size_t(0); i < size; ++i) {
+            auto const now = static_cast<Float>(history.size() - size + i);
+            REQUIRE(block[i] == Catch::Approx(reference(history, now - expectedDelay)).margin(1e-5));
+        }
+    }
+}
+
+TEST_CASE("audio/delay: BlockDelayLine ramps the delay")
+{
+    using Delay = grit::BlockDelayLine<double, 8>;
+
+    auto buffer = std::vector<double>(256);
+    auto delay  = Delay{etl::mdspan{buffer.data(), etl::dextents<etl::size_t, 1>{buffer.size()}}};
+    delay.setDelay(4.0);
+    delay.reset();
+
+    auto history = std::vector<double>{};
+    auto block   = std::vector<double>(8);
+    auto process = [&] {
+        for (auto& sample : block) {
+            sample = etl::sin(0.01 * double(history.size()));
+            history.push_back(sample);
+        }
+        delay.process(block, block);
+    };
+
+    process();
+
+    // A jump of 20 samples is spread over three blocks of 8.
+    delay.setDelay(24.0);
+    auto current = 4.0;
+    for (auto b = 0; b < 4; ++b) {
+        process();
+
+        auto const end  = etl::min(current + 8.0, 24.0);
+        auto const step = (end - current) / 8.0;
+        for (auto i = std::size_t(0); i < block.size(); ++i) {
+            auto const now      = double(history.size() - block.size() + i);
+            auto const expected = reference(history, now - (current + step * double(i + 1)));
+            REQUIRE(block[i] == Catch::Approx(expected).margin(1e-9));
+        }
+        current = end;
+    }
+}
+
+TEST_CASE("audio/delay: BlockDelayLineQ15")
+{
+    using Delay = grit::BlockDelayLineQ15<float, 16>;
+
+    STATIC_REQUIRE(etl::is_same_v<Delay::StorageType, etl::int16_t>);
+
+    // Half the memory of a float buffer with the same length.
+    auto memory = std::vector<etl::byte>(1024);
+    auto arena  = grit::MemoryArena{memory};
+    auto buffer = arena.allocate<etl::int16_t>(500);
+    REQUIRE(buffer.size() == 500);
+
+    auto delay = Delay{etl::mdspan{buffer.data(), etl::dextents<etl::size_t, 1>{buffer.size()}}};
+    delay.setDelay(64.25F);
+    delay.reset();
+
+    auto history = std::vector<float>{};
+    auto block   = std::vector<float>(16);
+    for (auto b = 0; b < 100; ++b) {
+        for (auto& sample : block) {
+            sample = 0.9F * etl::sin(0.05F * static_cast<float>(history.size()));
+            history.push_back(sample);
+        }
+
+        delay.process(block, block);
+
+        for (auto i = std::size_t(0); i < block.size(); ++i) {
+            auto const now = static_cast<float>(history.size() - block.size() + i);
+            REQUIRE(block[i] == Catch::Approx(reference(history, now - 64.25F)).margin(1e-4));
+        }
+    }
+
+    // Out of range samples saturate in the buffer.
+    delay.setDelay(2.0F);
+    delay.reset();
+    etl::fill(block.begin(), block.end(), 4.0F);
+    delay.process(block, block);
+    delay.process(block, block);
+    REQUIRE(block.back() == Catch::Approx(1.0F).margin(1e-4));
+}
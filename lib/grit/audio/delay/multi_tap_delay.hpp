@@ -0,0 +1,215 @@
+#pragma once
+
+#include <grit/audio/filter/state_variable_filter.hpp>
+#include <grit/math/buffer_interpolation.hpp>
+#include <grit/unit/time.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/concepts.hpp>
+#include <etl/mdspan.hpp>
+#include <etl/span.hpp>
+
+namespace grit {
+
+/// \brief Modulated multi-tap delay sharing one ring buffer.
+///
+/// \details Every tap reads the same buffer at its own delay time, so adding
+/// a tap costs one interpolated read instead of another buffer. The delay
+/// times glide to new values with a one pole smoother. The block process()
+/// optionally takes a per sample modulation for each tap, which is what a
+/// chorus or flanger drives with its lfos. The first tap is fed back into
+/// the buffer through a lowpass.
+///
+/// The output is the sum of the taps only, mixing in the dry signal is up to
+/// the caller. Delays are clamped to [2, size - 3] samples, so the four point
+/// interpolations never read the slot that is about to be written.
+///
+/// \ingroup grit-audio-delay
+template<
+    etl::floating_point Float,
+    typename Extent,
+    etl::size_t Taps,
+    typename Interpolation = BufferInterpolation::Hermite>
+struct MultiTapDelay
+{
+    static_assert(Taps >= 1);
+
+    using SampleType = Float;
+    using Buffer     = etl::mdspan<Float, Extent>;
+
+    /// Offset in samples for tap t at sample i of the block, modulation(t, i)
+    using Modulation = etl::mdspan<Float const, etl::extents<etl::size_t, Taps, etl::dynamic_extent>>;
+
+    struct Tap
+    {
+        Milliseconds<Float> delay{0};
+        Float gain{1};
+    };
+
+    struct Parameter
+    {
+        etl::array<Tap, Taps> taps{};
+        Float feedback{0};
+        Float damping{8'000};
+        Milliseconds<Float> smoothing{50};
+    };
+
+    explicit MultiTapDelay(Buffer buffer);
+
+    [[nodiscard]] static constexpr auto taps() -> etl::size_t { return Taps; }
+
+    auto setParameter(Parameter const& parameter) -> void;
+    auto setSampleRate(Float sampleRate) -> void;
+
+    /// Clears the buffer and jumps to the target delay times.
+    auto reset() -> void;
+
+    [[nodiscard]] auto operator()(Float x) -> Float;
+
+    /// Processes a block of samples. Equivalent to calling operator() on every sample.
+    /// \pre input.size() == output.size(), input & output may alias
+    auto process(etl::span<Float const> input, etl::span<Float> output) -> void;
+
+    /// Same as above, with modulation(t, i) samples added to the delay of tap t.
+    /// \pre input.size() == output.size() == modulation.extent(1), input & output may alias
+    auto process(etl::span<Float const> input, etl::span<Float> output, Modulation modulation) -> void;
+
+private:
+    auto update() -> void;
+
+    template<typename Offset>
+    [[nodiscard]] auto tick(Float x, Offset offset) -> Float;
+
+    [[nodiscard]] auto read(Float delay) -> Float;
+
+    Buffer _buffer;
+    TETL_NO_UNIQUE_ADDRESS Interpolation _interpolator{};
+    StateVariableLowpass<Float> _damping{};
+
+    Parameter _parameter{};
+    Float _sampleRate{0};
+    Float _smoothingCoef{0};
+    etl::array<Float, Taps> _target{};
+    etl::array<Float, Taps> _delay{};
+    etl::size_t _writePos{0};
+};
+
+template<etl::floating_point Float, typename Extent, etl::size_t Taps, typename Interpolation>
+MultiTapDelay<Float, Extent, Taps, Interpolation>::MultiTapDelay(Buffer buffer) : _buffer{buffer}
+{}
+
+template<etl::floating_point Float, typename Extent, etl::size_t Taps, typename Interpolation>
+auto MultiTapDelay<Float, Extent, Taps, Interpolation>::setParameter(Parameter const& parameter) -> void
+{
+    _parameter = parameter;
+    update();
+}
+
+template<etl::floating_point Float, typename Extent, etl::size_t Taps, typename Interpolation>
+auto MultiTapDelay<Float, Extent, Taps, Interpolation>::setSampleRate(Float sampleRate) -> void
+{
+    _sampleRate = sampleRate;
+    _damping.setSampleRate(sampleRate);
+    update();
+    reset();
+}
+
+template<etl::floating_point Float, typename Extent, etl::size_t Taps, typename Interpolation>
+auto MultiTapDelay<Float, Extent, Taps, Interpolation>::reset() -> void
+{
+    for (auto i = etl::size_t(0); i < _buffer.extent(0); ++i) {
+        _buffer(i) = Float(0);
+    }
+    _damping.reset();
+    _delay    = _target;
+    _writePos = 0;
+}
+
+template<etl::floating_point Float, typename Extent, etl::size_t Taps, typename Interpolation>
+auto MultiTapDelay<Float, Extent, Taps, Interpolation>::operator()(Float x) -> Float
+{
+    return tick(x, [](etl::size_t) { return Float(0); });
+}
+
+template<etl::floating_point Float, typename Extent, etl::size_t Taps, typename Interpolation>
+auto MultiTapDelay<Float, Extent, Taps, Interpolation>::process(
+    etl::span<Float const> input,
+    etl::span<Float> output
+) -> void
+{
+    for (auto i = etl::size_t(0); i < input.size(); ++i) {
+        output[i] = tick(input[i], [](etl::size_t) { return Float(0); });
+    }
+}
+
+template<etl::floating_point Float, typename Extent, etl::size_t Taps, typename Interpolation>
+auto MultiTapDelay<Float, Extent, Taps, Interpolation>::process(
+    etl::span<Float const> input,
+    etl::span<Float> output,
+    Modulation modulation
+) -> void
+{
+    for (auto i = etl::size_t(0); i < input.size(); ++i) {
+        output[i] = tick(input[i], [modulation, i](etl::size_t tap) { return modulation(tap, i); });
+    }
+}
+
+template<etl::floating_point Float, typename Extent, etl::size_t Taps, typename Interpolation>
+template<typename Offset>
+auto MultiTapDelay<Float, Extent, Taps, Interpolation>::tick(Float x, Offset offset) -> Float
+{
+    auto const coef = _smoothingCoef;
+
+    auto first = Float(0);
+    auto out   = Float(0);
+    for (auto t = etl::size_t(0); t < Taps; ++t) {
+        _delay[t] = coef * (_delay[t] - _target[t]) + _target[t];
+
+        auto const tap = read(_delay[t] + offset(t));
+        out += tap * _parameter.taps[t].gain;
+        if (t == 0) {
+            first = tap;
+        }
+    }
+
+    _buffer(_writePos) = x + _damping(first) * _parameter.feedback;
+    _writePos          = _writePos == 0 ? _buffer.extent(0) - 1 : _writePos - 1;
+
+    return out;
+}
+
+template<etl::floating_point Float, typename Extent, etl::size_t Taps, typename Interpolation>
+auto MultiTapDelay<Float, Extent, Taps, Interpolation>::read(Float delay) -> Float
+{
+    auto const size    = _buffer.extent(0);
+    auto const clamped = etl::clamp(delay, Float(2), static_cast<Float>(size - 3));
+    auto const whole   = static_cast<etl::size_t>(clamped);
+    auto const frac    = clamped - static_cast<Float>(whole);
+
+    // The slot at _writePos isn't written yet, the sample from d ago is at _writePos + d.
+    auto const sum     = _writePos + whole;
+    auto const readPos = sum >= size ? sum - size : sum;
+    return _interpolator(_buffer, readPos, frac);
+}
+
+template<etl::floating_point Float, typename Extent, etl::size_t Taps, typename Interpolation>
+auto MultiTapDelay<Float, Extent, Taps, Interpolation>::update() -> void
+{
+    static constexpr auto const log001 = etl::log(Float(0.01));
+
+    for (auto t = etl::size_t(0); t < Taps; ++t) {
+        _target[t] = Seconds<Float>{_parameter.taps[t].delay}.count() * _sampleRate;
+    }
+
+    auto const smoothing = _parameter.smoothing.count() * _sampleRate * Float(0.001);
+    _smoothingCoef       = smoothing > Float(0) ? etl::exp(log001 / smoothing) : Float(0);
+
+    _damping.setParameter({
+        .cutoff    = etl::min(etl::max(_parameter.damping, Float(20)), _sampleRate * Float(0.45)),
+        .resonance = Float(0.5),
+    });
+}
+
+}  // namespace grit
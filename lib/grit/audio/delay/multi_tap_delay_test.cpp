@@ -0,0 +1,127 @@
+#include "multi_tap_delay.hpp"
+
+#include <etl/array.hpp>
+#include <etl/mdspan.hpp>
+#include <etl/numeric.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+namespace {
+
+inline constexpr auto sampleRate = 48'000.0;
+
+template<typename Float>
+[[nodiscard]] auto samplesToMs(double samples) -> grit::Milliseconds<Float>
+{
+    return grit::Milliseconds<Float>{static_cast<Float>(samples * 1'000.0 / sampleRate)};
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE(
+    "audio/delay: MultiTapDelay",
+    "",
+    grit::BufferInterpolation::Linear,
+    grit::BufferInterpolation::Hermite,
+    grit::BufferInterpolation::Lagrange,
+    grit::BufferInterpolation::MaskedHermite
+)
+{
+    using Float         = float;
+    using Interpolation = TestType;
+    using Delay         = grit::MultiTapDelay<Float, etl::dextents<etl::size_t, 1>, 2, Interpolation>;
+
+    STATIC_REQUIRE(Delay::taps() == 2);
+
+    auto buffer = etl::array<Float, 128>{};
+    auto delay  = Delay{etl::mdspan{buffer.data(), etl::dextents<etl::size_t, 1>{buffer.size()}}};
+    delay.setSampleRate(Float(sampleRate));
+
+    SECTION("taps")
+    {
+        delay.setParameter({
+            .taps = {{
+                {.delay = samplesToMs<Float>(10), .gain = Float(1)},
+                {.delay = samplesToMs<Float>(25), .gain = Float(0.5)},
+            }},
+        });
+        delay.reset();
+
+        auto block = etl::array<Float, 64>{};
+        block[0]   = Float(1);
+        delay.process(block, block);
+
+        for (auto i = etl::size_t(0); i < block.size(); ++i) {
+            auto const expected = i == 10 ? 1.0 : (i == 25 ? 0.5 : 0.0);
+            CAPTURE(i);
+            REQUIRE_THAT(block[i], Catch::Matchers::WithinAbs(expected, 1e-4));
+        }
+    }
+
+    SECTION("feedback")
+    {
+        delay.setParameter({
+            .taps     = {{{.delay = samplesToMs<Float>(20), .gain = Float(1)}, {.gain = Float(0)}}},
+            .feedback = Float(0.5),
+            .damping  = Float(20'000),
+        });
+        delay.reset();
+
+        auto out = etl::array<Float, 100>{};
+        for (auto i = etl::size_t(0); i < out.size(); ++i) {
+            out[i] = delay(i == 0 ? Float(1) : Float(0));
+        }
+
+        // Each repeat is halved. The damping lowpass smears it, but has unity gain at dc.
+        auto sum = [&out](etl::size_t first, etl::size_t last) {
+            return etl::accumulate(out.begin() + first, out.begin() + last, 0.0);
+        };
+        REQUIRE(sum(0, 20) == Catch::Approx(0.0).margin(1e-4));
+        REQUIRE(out[20] == Catch::Approx(1.0).margin(1e-4));
+        REQUIRE(sum(21, 40) == Catch::Approx(0.0).margin(1e-4));
+        REQUIRE(sum(40, 60) == Catch::Approx(0.5).margin(0.01));
+        REQUIRE(sum(60, 80) == Catch::Approx(0.25).margin(0.01));
+    }
+
+    SECTION("modulation")
+    {
+        delay.setParameter({.taps = {{{.delay = samplesToMs<Float>(30)}, {.gain = Float(0)}}}});
+        delay.reset();
+
+        // Modulation shifts the read position by whole samples.
+        auto offsets = etl::array<Float, 2 * 64>{};
+        for (auto i = etl::size_t(0); i < 64; ++i) {
+            offsets[i] = Float(-10);
+        }
+        auto const modulation = typename Delay::Modulation{offsets.data(), 64};
+
+        auto block = etl::array<Float, 64>{};
+        block[0]   = Float(1);
+        delay.process(block, block, modulation);
+
+        for (auto i = etl::size_t(0); i < block.size(); ++i) {
+            CAPTURE(i);
+            REQUIRE_THAT(block[i], Catch::Matchers::WithinAbs(i == 20 ? 1.0 : 0.0, 1e-4));
+        }
+    }
+
+    SECTION("smoothing")
+    {
+        delay.setParameter({.taps = {{{.delay = samplesToMs<Float>(10)}, {.gain = Float(0)}}}});
+        delay.reset();
+        delay.setParameter({
+            .taps      = {{{.delay = samplesToMs<Float>(50)}, {.gain = Float(0)}}},
+            .smoothing = grit::Milliseconds<Float>{1},
+        });
+
+        // A constant input stays constant while the delay time glides.
+        for (auto i{0}; i < 200; ++i) {
+            auto const out = delay(Float(1));
+            if (i > 60) {
+                REQUIRE_THAT(out, Catch::Matchers::WithinAbs(1.0, 1e-4));
+            }
+        }
+    }
+}
@@ -46,13 +46,16 @@ template<etl::floating_point Float, typename Extent, typename Interpolation>
 auto NonOwningDelayLine<Float, Extent, Interpolation>::pushSample(Float sample) -> void
 {
     _buffer(_writePos) = sample;
-    _writePos          = (_writePos - 1 + _buffer.extent(0)) % _buffer.extent(0);
+    _writePos          = _writePos == 0 ? _buffer.extent(0) - 1 : _writePos - 1;
 }
 
 template<etl::floating_point Float, typename Extent, typename Interpolation>
 auto NonOwningDelayLine<Float, Extent, Interpolation>::popSample() -> Float
 {
-    auto const readPos = _writePos + _delay;
+    // Both are below the size, a single subtraction wraps the sum.
+    auto const size    = _buffer.extent(0);
+    auto const sum     = _writePos + _delay;
+    auto const readPos = sum >= size ? sum - size : sum;
     return _interpolator(_buffer, readPos, _frac);
 }
 
@@ -8,7 +8,9 @@ TEMPLATE_TEST_CASE(
     "",
     grit::BufferInterpolation::None,
     grit::BufferInterpolation::Linear,
-    grit::BufferInterpolation::Hermite
+    grit::BufferInterpolation::Hermite,
+    grit::BufferInterpolation::MaskedLinear,
+    grit::BufferInterpolation::MaskedHermite
 )
 {
     using Interpolator = TestType;
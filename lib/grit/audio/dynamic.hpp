@@ -7,4 +7,5 @@
 #include <grit/audio/dynamic/dynamic.hpp>
 #include <grit/audio/dynamic/gain_computer.hpp>
 #include <grit/audio/dynamic/level_detector.hpp>
+#include <grit/audio/dynamic/log_domain_dynamic.hpp>
 #include <grit/audio/dynamic/transient_shaper.hpp>
@@ -3,6 +3,7 @@
 #include <grit/audio/dynamic/dynamic.hpp>
 #include <grit/audio/dynamic/gain_computer.hpp>
 #include <grit/audio/dynamic/level_detector.hpp>
+#include <grit/audio/dynamic/log_domain_dynamic.hpp>
 #include <grit/audio/envelope/envelope_follower.hpp>
 
 namespace grit {
@@ -17,4 +18,24 @@ template<etl::floating_point Float>
 using SoftKneeCompressor
     = Dynamic<Float, PeakLevelDetector<Float>, SoftKneeGainComputer<Float>, EnvelopeFollower<Float>>;
 
+/// \brief HardKneeCompressor with the gain computed every Decimation samples.
+/// \details With a StereoFrame sample both channels share one gain.
+/// \ingroup grit-audio-dynamic
+template<audio_sample Sample, etl::size_t Decimation = 16>
+using LogDomainHardKneeCompressor = LogDomainDynamic<
+    Sample,
+    HardKneeGainComputer<SampleValueType<Sample>>,
+    EnvelopeFollower<SampleValueType<Sample>>,
+    Decimation>;
+
+/// \brief SoftKneeCompressor with the gain computed every Decimation samples.
+/// \details With a StereoFrame sample both channels share one gain.
+/// \ingroup grit-audio-dynamic
+template<audio_sample Sample, etl::size_t Decimation = 16>
+using LogDomainSoftKneeCompressor = LogDomainDynamic<
+    Sample,
+    SoftKneeGainComputer<SampleValueType<Sample>>,
+    EnvelopeFollower<SampleValueType<Sample>>,
+    Decimation>;
+
 }  // namespace grit
@@ -3,6 +3,8 @@
 #include <grit/unit/decibel.hpp>
 #include <grit/unit/time.hpp>
 
+#include <etl/span.hpp>
+
 namespace grit {
 
 /// \ingroup grit-audio-dynamic
@@ -39,7 +41,20 @@ struct Dynamic
         auto const yg = _gainComputer(xg);
         auto const xl = xg - yg;
         auto const yl = _ballistics(xl);
-        return x * fromDecibels(makeUpGain - yl);
+        return x * fast::fromDecibels(makeUpGain - yl);
+    }
+
+    /// Processes a block of samples. Equivalent to calling operator() on every sample.
+    /// \pre input.size() == output.size(), input & output may alias
+    auto process(etl::span<Float const> input, etl::span<Float> output) -> void { process(input, input, output); }
+
+    /// Processes a block of samples with an external sidechain.
+    /// \pre input.size() == sidechain.size() == output.size(), input & output may alias
+    auto process(etl::span<Float const> input, etl::span<Float const> sidechain, etl::span<Float> output) -> void
+    {
+        for (auto i = etl::size_t(0); i < input.size(); ++i) {
+            output[i] = (*this)(input[i], sidechain[i]);
+        }
     }
 
 private:
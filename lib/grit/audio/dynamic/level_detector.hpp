@@ -10,7 +10,7 @@ struct PeakLevelDetector
 {
     PeakLevelDetector() = default;
 
-    [[nodiscard]] constexpr auto operator()(Float x) -> Float { return toDecibels(x); }
+    [[nodiscard]] constexpr auto operator()(Float x) -> Float { return fast::toDecibels(x); }
 };
 
 }  // namespace grit
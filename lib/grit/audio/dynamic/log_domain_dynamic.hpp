@@ -0,0 +1,169 @@
+#pragma once
+
+#include <grit/audio/stereo/stereo_frame.hpp>
+#include <grit/unit/decibel.hpp>
+#include <grit/unit/time.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/cmath.hpp>
+#include <etl/concepts.hpp>
+#include <etl/span.hpp>
+
+namespace grit {
+
+/// \brief Dynamic with the gain computed at a control rate.
+///
+/// \details The sidechain peak is collected over Decimation samples, then
+/// converted with fast::toDecibels, run through the gain computer & the
+/// ballistics and converted back with fast::fromDecibels, once per control
+/// period. The gain is ramped linearly towards the new value over the next
+/// period, so per sample only the peak & a multiply-add remain.
+///
+/// The ballistics run at the control rate, attack & release times are in
+/// the same units as for Dynamic. With a StereoFrame sample the peak of both
+/// channels is used, which links the stereo image with a single gain.
+///
+/// \ingroup grit-audio-dynamic
+template<audio_sample Sample, typename GainComputer, typename Ballistics, etl::size_t Decimation = 16>
+struct LogDomainDynamic
+{
+    static_assert(Decimation > 0);
+
+    using SampleType = Sample;
+    using ValueType  = SampleValueType<Sample>;
+
+    struct Parameter
+    {
+        Decibels<ValueType> threshold{0.0};
+        Decibels<ValueType> knee{0.0};
+        ValueType ratio{1.0};
+
+        Milliseconds<ValueType> attack{50};
+        Milliseconds<ValueType> release{50};
+    };
+
+    LogDomainDynamic() = default;
+
+    [[nodiscard]] static constexpr auto decimation() -> etl::size_t { return Decimation; }
+
+    auto setParameter(Parameter param) -> void;
+    auto setSampleRate(ValueType sampleRate) -> void;
+    auto reset() -> void;
+
+    [[nodiscard]] auto operator()(Sample x) -> Sample { return (*this)(x, x); }
+
+    [[nodiscard]] auto operator()(Sample x, Sample sidechain) -> Sample;
+
+    /// Processes a block of samples. Equivalent to calling operator() on every sample.
+    /// \pre input.size() == output.size(), input & output may alias
+    auto process(etl::span<Sample const> input, etl::span<Sample> output) -> void { process(input, input, output); }
+
+    /// Processes a block of samples with an external sidechain.
+    /// \pre input.size() == sidechain.size() == output.size(), input & output may alias
+    auto process(etl::span<Sample const> input, etl::span<Sample const> sidechain, etl::span<Sample> output) -> void;
+
+private:
+    [[nodiscard]] static auto level(Sample x) -> ValueType;
+
+    auto updateGain() -> void;
+
+    ValueType _peak{0};
+    ValueType _gain{1};
+    ValueType _step{0};
+    etl::size_t _position{0};
+
+    TETL_NO_UNIQUE_ADDRESS GainComputer _gainComputer;
+    TETL_NO_UNIQUE_ADDRESS Ballistics _ballistics;
+};
+
+template<audio_sample Sample, typename GainComputer, typename Ballistics, etl::size_t Decimation>
+auto LogDomainDynamic<Sample, GainComputer, Ballistics, Decimation>::setParameter(Parameter param) -> void
+{
+    _gainComputer.setParameter({param.threshold, param.knee, param.ratio});
+    _ballistics.setParameter({param.attack, param.release});
+}
+
+template<audio_sample Sample, typename GainComputer, typename Ballistics, etl::size_t Decimation>
+auto LogDomainDynamic<Sample, GainComputer, Ballistics, Decimation>::setSampleRate(ValueType sampleRate) -> void
+{
+    _ballistics.setSampleRate(sampleRate / static_cast<ValueType>(Decimation));
+    reset();
+}
+
+template<audio_sample Sample, typename GainComputer, typename Ballistics, etl::size_t Decimation>
+auto LogDomainDynamic<Sample, GainComputer, Ballistics, Decimation>::reset() -> void
+{
+    _ballistics.reset();
+    _peak     = ValueType(0);
+    _gain     = ValueType(1);
+    _step     = ValueType(0);
+    _position = 0;
+}
+
+template<audio_sample Sample, typename GainComputer, typename Ballistics, etl::size_t Decimation>
+auto LogDomainDynamic<Sample, GainComputer, Ballistics, Decimation>::operator()(Sample x, Sample sidechain) -> Sample
+{
+    _peak        = etl::max(_peak, level(sidechain));
+    auto const y = x * _gain;
+    _gain += _step;
+
+    if (++_position == Decimation) {
+        updateGain();
+    }
+
+    return y;
+}
+
+template<audio_sample Sample, typename GainComputer, typename Ballistics, etl::size_t Decimation>
+auto LogDomainDynamic<Sample, GainComputer, Ballistics, Decimation>::process(
+    etl::span<Sample const> input,
+    etl::span<Sample const> sidechain,
+    etl::span<Sample> output
+) -> void
+{
+    for (auto i = etl::size_t(0); i < input.size();) {
+        auto const count = etl::min(Decimation - _position, input.size() - i);
+
+        auto peak = _peak;
+        auto gain = _gain;
+        for (auto j = i; j < i + count; ++j) {
+            peak      = etl::max(peak, level(sidechain[j]));
+            output[j] = input[j] * gain;
+            gain += _step;
+        }
+
+        _peak = peak;
+        _gain = gain;
+        _position += count;
+        i += count;
+
+        if (_position == Decimation) {
+            updateGain();
+        }
+    }
+}
+
+template<audio_sample Sample, typename GainComputer, typename Ballistics, etl::size_t Decimation>
+auto LogDomainDynamic<Sample, GainComputer, Ballistics, Decimation>::level(Sample x) -> ValueType
+{
+    if constexpr (etl::floating_point<Sample>) {
+        return etl::abs(x);
+    } else {
+        return etl::max(etl::abs(x.left), etl::abs(x.right));
+    }
+}
+
+template<audio_sample Sample, typename GainComputer, typename Ballistics, etl::size_t Decimation>
+auto LogDomainDynamic<Sample, GainComputer, Ballistics, Decimation>::updateGain() -> void
+{
+    auto const xg     = fast::toDecibels(_peak);
+    auto const yg     = _gainComputer(xg);
+    auto const yl     = _ballistics(xg - yg);
+    auto const target = fast::fromDecibels(-yl);
+
+    _step     = (target - _gain) / static_cast<ValueType>(Decimation);
+    _peak     = ValueType(0);
+    _position = 0;
+}
+
+}  // namespace grit
@@ -0,0 +1,111 @@
+#include "log_domain_dynamic.hpp"
+
+#include <grit/audio/dynamic/compressor.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+
+namespace {
+
+template<typename Float>
+auto makeParameter(Float threshold, Float ratio)
+{
+    return typename grit::LogDomainSoftKneeCompressor<Float>::Parameter{
+        .threshold = grit::Decibels<Float>{threshold},
+        .knee      = grit::Decibels<Float>{Float(0)},
+        .ratio     = ratio,
+        .attack    = grit::Milliseconds<Float>{Float(1)},
+        .release   = grit::Milliseconds<Float>{Float(10)},
+    };
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("audio/dynamic: LogDomainSoftKneeCompressor", "", float, double)
+{
+    using Float = TestType;
+
+    auto compressor = grit::LogDomainSoftKneeCompressor<Float>{};
+    compressor.setSampleRate(Float(48'000));
+
+    SECTION("below threshold")
+    {
+        compressor.setParameter(makeParameter(Float(-6), Float(4)));
+        for (auto i = 0; i < 4'800; ++i) {
+            auto const x = Float(0.25) * static_cast<Float>(etl::sin(static_cast<double>(i) * 0.1));
+            REQUIRE(compressor(x) == Catch::Approx(x).margin(1e-4));
+        }
+    }
+
+    SECTION("matches SoftKneeCompressor")
+    {
+        // 12 dB over the threshold at 4:1 is 9 dB of gain reduction.
+        auto reference = grit::SoftKneeCompressor<Float>{};
+        reference.setSampleRate(Float(48'000));
+        reference.setParameter({
+            .threshold = grit::Decibels<Float>{Float(-12)},
+            .knee      = grit::Decibels<Float>{Float(0)},
+            .ratio     = Float(4),
+            .attack    = grit::Milliseconds<Float>{Float(1)},
+            .release   = grit::Milliseconds<Float>{Float(10)},
+        });
+        compressor.setParameter(makeParameter(Float(-12), Float(4)));
+
+        auto y    = Float(0);
+        auto yRef = Float(0);
+        for (auto i = 0; i < 4'800; ++i) {
+            y    = compressor(Float(1));
+            yRef = reference(Float(1));
+        }
+
+        REQUIRE(yRef == Catch::Approx(grit::fromDecibels(Float(-9))).epsilon(1e-3));
+        REQUIRE(y == Catch::Approx(yRef).epsilon(1e-3));
+    }
+
+    SECTION("block matches per sample")
+    {
+        compressor.setParameter(makeParameter(Float(-20), Float(8)));
+        auto other = compressor;
+
+        auto input = etl::array<Float, 101>{};
+        for (auto i = etl::size_t(0); i < input.size(); ++i) {
+            input[i] = static_cast<Float>(etl::sin(static_cast<double>(i) * 0.05)) * Float(0.8);
+        }
+
+        auto output = etl::array<Float, 101>{};
+        other.process(etl::span{input}.first(37), etl::span{output}.first(37));
+        other.process(etl::span{input}.subspan(37), etl::span{output}.subspan(37));
+
+        for (auto i = etl::size_t(0); i < input.size(); ++i) {
+            REQUIRE(output[i] == Catch::Approx(compressor(input[i])));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/dynamic: LogDomainSoftKneeCompressor<StereoFrame>", "", float, double)
+{
+    using Float = TestType;
+    using Frame = grit::StereoFrame<Float>;
+
+    auto compressor = grit::LogDomainSoftKneeCompressor<Frame>{};
+    compressor.setSampleRate(Float(48'000));
+    compressor.setParameter({
+        .threshold = grit::Decibels<Float>{Float(-12)},
+        .knee      = grit::Decibels<Float>{Float(0)},
+        .ratio     = Float(4),
+        .attack    = grit::Milliseconds<Float>{Float(1)},
+        .release   = grit::Milliseconds<Float>{Float(10)},
+    });
+
+    // The quiet right channel is reduced by the gain of the loud left one.
+    auto y = Frame{};
+    for (auto i = 0; i < 4'800; ++i) {
+        y = compressor(Frame{Float(1), Float(0.1)});
+    }
+
+    REQUIRE(y.left == Catch::Approx(grit::fromDecibels(Float(-9))).epsilon(1e-3));
+    REQUIRE(y.right == Catch::Approx(y.left * Float(0.1)));
+}
@@ -72,16 +72,16 @@ auto TransientShaper<Float>::operator()(Float x) -> Float
     auto const absX = etl::abs(x);
 
     // Attack
-    auto const aenv1 = toDecibels(_attack1(absX) + dbOffset);
-    auto const aenv2 = toDecibels(_attack2(absX) + dbOffset);
+    auto const aenv1 = fast::toDecibels(_attack1(absX) + dbOffset);
+    auto const aenv2 = fast::toDecibels(_attack2(absX) + dbOffset);
     auto const adiff = etl::clamp((aenv1 - aenv2) * _parameter.attack, -maxGain, +maxGain);
-    auto const again = fromDecibels(adiff);
+    auto const again = fast::fromDecibels(adiff);
 
     // Sustain
-    auto const senv1 = toDecibels(_sustain1(absX) + dbOffset);
-    auto const senv2 = toDecibels(_sustain2(absX) + dbOffset);
+    auto const senv1 = fast::toDecibels(_sustain1(absX) + dbOffset);
+    auto const senv2 = fast::toDecibels(_sustain2(absX) + dbOffset);
     auto const sdiff = etl::clamp((senv1 - senv2) * _parameter.sustain, -maxGain, +maxGain);
-    auto const sgain = fromDecibels(sdiff);
+    auto const sgain = fast::fromDecibels(sdiff);
 
     return x * (again * sgain);
 }
@@ -28,6 +28,18 @@ struct EnvelopeADSR
         Milliseconds<Float> release{0};
     };
 
+    /// One-pole segment coefficients: output = base + output * coef
+    struct Coefficients
+    {
+        Float attackBase;
+        Float attackCoef;
+        Float decayBase;
+        Float decayCoef;
+        Float releaseBase;
+        Float releaseCoef;
+        Float sustainLevel;
+    };
+
     constexpr EnvelopeADSR();
 
     constexpr auto setParameter(Parameter const& parameter) -> void;
@@ -38,6 +50,8 @@ struct EnvelopeADSR
 
     [[nodiscard]] constexpr auto operator()() -> Float;
 
+    [[nodiscard]] constexpr auto coefficients() const -> Coefficients;
+
 private:
     enum State : etl::uint8_t
     {
@@ -181,6 +195,20 @@ constexpr auto EnvelopeADSR<Float>::reset() -> void
     _output = Float(0);
 }
 
+template<etl::floating_point Float>
+constexpr auto EnvelopeADSR<Float>::coefficients() const -> Coefficients
+{
+    return {
+        .attackBase   = _attackBase,
+        .attackCoef   = _attackCoef,
+        .decayBase    = _decayBase,
+        .decayCoef    = _decayCoef,
+        .releaseBase  = _releaseBase,
+        .releaseCoef  = _releaseCoef,
+        .sustainLevel = _sustainLevel,
+    };
+}
+
 template<etl::floating_point Float>
 constexpr auto EnvelopeADSR<Float>::operator()() -> Float
 {
@@ -1,82 +1,136 @@
 #pragma once
 
+#include <grit/audio/stereo/stereo_frame.hpp>
+#include <grit/math/fast.hpp>
 #include <grit/unit/time.hpp>
 
 #include <etl/algorithm.hpp>
 #include <etl/cmath.hpp>
 #include <etl/concepts.hpp>
+#include <etl/span.hpp>
 
 namespace grit {
 
+/// \details With a StereoFrame sample both channels share the parameters,
+/// each lane follows its own channel.
 /// \ingroup grit-audio-envelope
-template<etl::floating_point Float>
+template<audio_sample Sample>
 struct EnvelopeFollower
 {
+    using SampleType = Sample;
+    using ValueType  = SampleValueType<Sample>;
+
     struct Parameter
     {
-        Milliseconds<Float> attack{50};
-        Milliseconds<Float> release{50};
+        Milliseconds<ValueType> attack{50};
+        Milliseconds<ValueType> release{50};
+
+        friend auto operator==(Parameter const& lhs, Parameter const& rhs) -> bool = default;
     };
 
     EnvelopeFollower() = default;
 
+    /// Only recomputes the coefficients if the parameter changed.
     auto setParameter(Parameter const& parameter) -> void;
 
     auto reset() -> void;
-    auto setSampleRate(Float sampleRate) -> void;
-    [[nodiscard]] auto operator()(Float in) -> Float;
+    auto setSampleRate(ValueType sampleRate) -> void;
+    [[nodiscard]] auto operator()(Sample in) -> Sample;
+
+    /// Processes a block of samples. Equivalent to calling operator() on every sample.
+    /// \pre input.size() == output.size(), input & output may alias
+    auto process(etl::span<Sample const> input, etl::span<Sample> output) -> void;
 
 private:
     auto update() -> void;
 
+    [[nodiscard]] static auto
+    tick(Sample in, Sample envelope, ValueType attackCoef, ValueType releaseCoef) -> Sample;
+
     Parameter _parameter{};
-    Float _sampleRate{};
-    Float _attackCoef{};
-    Float _releaseCoef{};
-    Float _envelope{};
+    ValueType _sampleRate{};
+    ValueType _attackCoef{};
+    ValueType _releaseCoef{};
+    Sample _envelope{};
 };
 
-template<etl::floating_point Float>
-auto EnvelopeFollower<Float>::setParameter(Parameter const& parameter) -> void
+template<audio_sample Sample>
+auto EnvelopeFollower<Sample>::setParameter(Parameter const& parameter) -> void
 {
+    if (parameter == _parameter) {
+        return;
+    }
+
     _parameter = parameter;
     update();
 }
 
-template<etl::floating_point Float>
-auto EnvelopeFollower<Float>::setSampleRate(Float sampleRate) -> void
+template<audio_sample Sample>
+auto EnvelopeFollower<Sample>::setSampleRate(ValueType sampleRate) -> void
 {
     _sampleRate = sampleRate;
     update();
     reset();
 }
 
-template<etl::floating_point Float>
-auto EnvelopeFollower<Float>::operator()(Float in) -> Float
+template<audio_sample Sample>
+auto EnvelopeFollower<Sample>::operator()(Sample in) -> Sample
 {
-    auto const env  = etl::abs(in);
-    auto const coef = env > _envelope ? _attackCoef : _releaseCoef;
-
-    _envelope = coef * (_envelope - env) + env;
+    _envelope = tick(in, _envelope, _attackCoef, _releaseCoef);
     return _envelope;
 }
 
-template<etl::floating_point Float>
-auto EnvelopeFollower<Float>::reset() -> void
+template<audio_sample Sample>
+auto EnvelopeFollower<Sample>::process(etl::span<Sample const> input, etl::span<Sample> output) -> void
+{
+    auto const attackCoef  = _attackCoef;
+    auto const releaseCoef = _releaseCoef;
+    auto envelope          = _envelope;
+
+    for (auto i = etl::size_t(0); i < input.size(); ++i) {
+        envelope  = tick(input[i], envelope, attackCoef, releaseCoef);
+        output[i] = envelope;
+    }
+
+    _envelope = envelope;
+}
+
+template<audio_sample Sample>
+auto EnvelopeFollower<Sample>::tick(Sample in, Sample envelope, ValueType attackCoef, ValueType releaseCoef) -> Sample
+{
+    auto const follow = [attackCoef, releaseCoef](ValueType x, ValueType y) {
+        auto const env  = etl::abs(x);
+        auto const coef = env > y ? attackCoef : releaseCoef;
+        return coef * (y - env) + env;
+    };
+
+    if constexpr (etl::floating_point<Sample>) {
+        return follow(in, envelope);
+    } else {
+        return {
+            follow(in.left, envelope.left),
+            follow(in.right, envelope.right),
+        };
+    }
+}
+
+template<audio_sample Sample>
+auto EnvelopeFollower<Sample>::reset() -> void
 {
-    _envelope = Float(0);
+    _envelope = Sample{};
 }
 
-template<etl::floating_point Float>
-auto EnvelopeFollower<Float>::update() -> void
+template<audio_sample Sample>
+auto EnvelopeFollower<Sample>::update() -> void
 {
-    static constexpr auto const log001 = etl::log(Float(0.01));
+    static constexpr auto const log001 = etl::log(ValueType(0.01));
 
     auto const attack  = _parameter.attack.count();
     auto const release = _parameter.release.count();
 
-    _attackCoef  = etl::exp(log001 / (attack * _sampleRate * Float(0.001)));
-    _releaseCoef = etl::exp(log001 / (release * _sampleRate * Float(0.001)));
+    // The coefficients sit close to 1, only the fine tier keeps the time constants accurate.
+    _attackCoef  = fast::exp<fast::Accuracy::Fine>(log001 / (attack * _sampleRate * ValueType(0.001)));
+    _releaseCoef = fast::exp<fast::Accuracy::Fine>(log001 / (release * _sampleRate * ValueType(0.001)));
 }
 
 }  // namespace grit
@@ -1,5 +1,7 @@
 #include "envelope_follower.hpp"
 
+#include <etl/array.hpp>
+
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 
@@ -44,3 +46,86 @@ TEMPLATE_TEST_CASE("audio/envelope: EnvelopeFollower", "", float, double)
     REQUIRE(y3 < Float(0.25));
     REQUIRE(y3 > Float(y1));
 }
+
+TEMPLATE_TEST_CASE("audio/envelope: EnvelopeFollower::process", "", float, double)
+{
+    using Float = TestType;
+
+    auto reference = grit::EnvelopeFollower<Float>{};
+    reference.setSampleRate(Float(44'100));
+    reference.setParameter({grit::Milliseconds<Float>{5}, grit::Milliseconds<Float>{50}});
+
+    auto block = reference;
+
+    auto buffer = etl::array<Float, 64>{};
+    for (auto i = size_t(0); i < buffer.size(); ++i) {
+        buffer[i] = i < buffer.size() / 2 ? Float(0.5) : Float(-0.125);
+    }
+
+    auto expected = buffer;
+    for (auto& x : expected) {
+        x = reference(x);
+    }
+
+    auto output = etl::array<Float, 64>{};
+    block.process(buffer, output);
+    for (auto i = size_t(0); i < buffer.size(); ++i) {
+        REQUIRE(output[i] == Catch::Approx(expected[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/envelope: EnvelopeFollower<StereoFrame>", "", float, double)
+{
+    using Float = TestType;
+    using Frame = grit::StereoFrame<Float>;
+
+    auto left = grit::EnvelopeFollower<Float>{};
+    left.setSampleRate(Float(44'100));
+    left.setParameter({grit::Milliseconds<Float>{5}, grit::Milliseconds<Float>{50}});
+    auto right = left;
+
+    auto packed = grit::EnvelopeFollower<Frame>{};
+    packed.setSampleRate(Float(44'100));
+    packed.setParameter({grit::Milliseconds<Float>{5}, grit::Milliseconds<Float>{50}});
+
+    auto buffer = etl::array<Frame, 64>{};
+    for (auto i = size_t(0); i < buffer.size(); ++i) {
+        buffer[i] = i < buffer.size() / 2 ? Frame{Float(0.5), Float(-0.125)} : Frame{Float(-0.125), Float(0.5)};
+    }
+
+    auto expected = buffer;
+    for (auto& x : expected) {
+        x = Frame{left(x.left), right(x.right)};
+    }
+
+    packed.process(buffer, buffer);
+    for (auto i = size_t(0); i < buffer.size(); ++i) {
+        REQUIRE(buffer[i].left == Catch::Approx(expected[i].left));
+        REQUIRE(buffer[i].right == Catch::Approx(expected[i].right));
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/envelope: EnvelopeFollower unchanged parameter", "", float, double)
+{
+    using Float = TestType;
+
+    auto const parameter = typename grit::EnvelopeFollower<Float>::Parameter{
+        .attack  = grit::Milliseconds<Float>{5},
+        .release = grit::Milliseconds<Float>{200},
+    };
+
+    auto expected = grit::EnvelopeFollower<Float>{};
+    expected.setSampleRate(Float(48'000));
+    expected.setParameter(parameter);
+
+    // Parameter before the sample rate, then set again unchanged
+    auto cached = grit::EnvelopeFollower<Float>{};
+    cached.setParameter(parameter);
+    cached.setSampleRate(Float(48'000));
+    cached.setParameter(parameter);
+
+    for (auto i{0}; i < 512; ++i) {
+        auto const x = i < 256 ? Float(0.5) : Float(0);
+        REQUIRE(cached(x) == Catch::Approx(expected(x)));
+    }
+}
@@ -4,5 +4,7 @@
 /// \ingroup grit-audio
 
 #include <grit/audio/filter/biquad.hpp>
+#include <grit/audio/filter/biquad_q15.hpp>
+#include <grit/audio/filter/biquad_q31.hpp>
 #include <grit/audio/filter/dynamic_smoothing.hpp>
 #include <grit/audio/filter/state_variable_filter.hpp>
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <grit/audio/stereo/stereo_frame.hpp>
+
 #include <etl/algorithm.hpp>
 #include <etl/array.hpp>
 #include <etl/cmath.hpp>
@@ -41,24 +43,31 @@ struct BiquadCoefficients
 };
 
 /// \brief 2nd order IIR filter using the transpose direct form 2 structure.
+/// \details With a StereoFrame sample both channels share the coefficients,
+/// the filter state is packed into the left/right lanes.
 /// \ingroup grit-audio-filter
-template<etl::floating_point Float>
+template<audio_sample Sample>
 struct Biquad
 {
-    using SampleType   = Float;
-    using Coefficients = BiquadCoefficients<Float>;
+    using SampleType   = Sample;
+    using ValueType    = SampleValueType<Sample>;
+    using Coefficients = BiquadCoefficients<ValueType>;
 
     constexpr Biquad() = default;
 
-    constexpr auto setCoefficients(etl::span<Float const, 6> coefficients) -> void;
+    constexpr auto setCoefficients(etl::span<ValueType const, 6> coefficients) -> void;
     constexpr auto reset() -> void;
 
-    [[nodiscard]] constexpr auto operator()(Float x) -> Float;
+    [[nodiscard]] constexpr auto operator()(Sample x) -> Sample;
+
+    /// Processes a block of samples. Equivalent to calling operator() on every sample.
+    /// \pre input.size() == output.size(), input & output may alias
+    constexpr auto process(etl::span<Sample const> input, etl::span<Sample> output) -> void;
 
 private:
     using Index = Coefficients::Index;
-    etl::array<Float, Index::NumCoefficients> _coefficients{Coefficients::makeBypass()};
-    etl::array<Float, 2> _z{};
+    etl::array<ValueType, Index::NumCoefficients> _coefficients{Coefficients::makeBypass()};
+    etl::array<Sample, 2> _z{};
 };
 
 template<etl::floating_point Float>
@@ -109,21 +118,21 @@ constexpr auto BiquadCoefficients<Float>::makeHighPass(Float cutoff, Float Q, Fl
     return {b0, b1, b2, a0, a1, a2};
 }
 
-template<etl::floating_point Float>
-constexpr auto Biquad<Float>::setCoefficients(etl::span<Float const, 6> coefficients) -> void
+template<audio_sample Sample>
+constexpr auto Biquad<Sample>::setCoefficients(etl::span<ValueType const, 6> coefficients) -> void
 {
     etl::copy(coefficients.begin(), coefficients.end(), _coefficients.begin());
 }
 
-template<etl::floating_point Float>
-constexpr auto Biquad<Float>::reset() -> void
+template<audio_sample Sample>
+constexpr auto Biquad<Sample>::reset() -> void
 {
-    _z[0] = Float(0);
-    _z[1] = Float(0);
+    _z[0] = Sample{};
+    _z[1] = Sample{};
 }
 
-template<etl::floating_point Float>
-constexpr auto Biquad<Float>::operator()(Float x) -> Float
+template<audio_sample Sample>
+constexpr auto Biquad<Sample>::operator()(Sample x) -> Sample
 {
     auto const b0 = _coefficients[Index::B0];
     auto const b1 = _coefficients[Index::B1];
@@ -137,4 +146,28 @@ constexpr auto Biquad<Float>::operator()(Float x) -> Float
     return y;
 }
 
+template<audio_sample Sample>
+constexpr auto Biquad<Sample>::process(etl::span<Sample const> input, etl::span<Sample> output) -> void
+{
+    auto const b0 = _coefficients[Index::B0];
+    auto const b1 = _coefficients[Index::B1];
+    auto const b2 = _coefficients[Index::B2];
+    auto const a1 = _coefficients[Index::A1];
+    auto const a2 = _coefficients[Index::A2];
+
+    auto z0 = _z[0];
+    auto z1 = _z[1];
+
+    for (auto i = etl::size_t(0); i < input.size(); ++i) {
+        auto const x = input[i];
+        auto const y = b0 * x + z0;
+        z0           = b1 * x - a1 * y + z1;
+        z1           = b2 * x - a2 * y;
+        output[i]    = y;
+    }
+
+    _z[0] = z0;
+    _z[1] = z1;
+}
+
 }  // namespace grit
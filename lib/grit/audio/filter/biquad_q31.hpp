@@ -0,0 +1,149 @@
+#pragma once
+
+#include <grit/math/fixed_point.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/cmath.hpp>
+#include <etl/concepts.hpp>
+#include <etl/cstdint.hpp>
+#include <etl/limits.hpp>
+#include <etl/span.hpp>
+
+namespace grit {
+
+/// \brief Q31 biquad in direct form 1 with a 64-bit accumulator.
+///
+/// \details Every tap is one 32x32 multiply-accumulate into 64 bits, smlal
+/// on ARM, the past outputs are kept in full Q31. Low cutoffs at high sample
+/// rates need more than 32-bit coefficients in plain Q2.29: a 50 Hz lowpass
+/// at 96 kHz has b0 around 3e-6 & its poles within 1e-5 of the unit circle.
+/// So the feedforward taps get their own exponent, and the feedback taps are
+/// stored as the residuals of the integrator pair, -a1 - 2 & -a2 + 1, with an
+/// exponent as well. The residuals hold the pole positions, the 2 * y1 - y2
+/// part is exact. The bits dropped when rounding the output are fed back into
+/// the next sample, without it the output sticks in a dead band around the
+/// settled value that grows with the gain of the poles. Takes the same
+/// coefficient layout as Biquad, see BiquadCoefficients.
+///
+/// \ingroup grit-audio-filter
+struct BiquadQ31
+{
+    using SampleType = Q31;
+
+    /// Fractional bits of coefficients with an exponent of 0, Q2.29.
+    static constexpr auto coefficientBits = 29;
+
+    BiquadQ31() = default;
+
+    template<etl::floating_point Float>
+    auto setCoefficients(etl::span<Float const, 6> coefficients) -> void;
+
+    auto reset() -> void;
+
+    [[nodiscard]] auto operator()(Q31 x) -> Q31;
+
+    /// Processes a block of samples. Equivalent to calling operator() on every sample.
+    /// \pre input.size() == output.size(), input & output may alias
+    auto process(etl::span<Q31 const> input, etl::span<Q31> output) -> void;
+
+private:
+    template<etl::floating_point Float>
+    [[nodiscard]] static auto exponent(Float a, Float b, Float c) -> int;
+
+    // b in Q2.(29 + _bShift), the residuals d1 = -a1 - 2 & d2 = -a2 + 1 in Q2.(29 + _dShift)
+    etl::int32_t _b0{1 << coefficientBits};
+    etl::int32_t _b1{0};
+    etl::int32_t _b2{0};
+    etl::int32_t _d1{-2 << coefficientBits};
+    etl::int32_t _d2{1 << coefficientBits};
+    int _bShift{0};
+    int _dShift{0};
+
+    etl::int32_t _x1{0};
+    etl::int32_t _x2{0};
+    etl::int32_t _y1{0};
+    etl::int32_t _y2{0};
+    etl::int64_t _error{0};
+};
+
+template<etl::floating_point Float>
+auto BiquadQ31::setCoefficients(etl::span<Float const, 6> coefficients) -> void
+{
+    auto const a0 = coefficients[3];
+    auto const b0 = coefficients[0] / a0;
+    auto const b1 = coefficients[1] / a0;
+    auto const b2 = coefficients[2] / a0;
+    auto const d1 = -coefficients[4] / a0 - Float(2);
+    auto const d2 = -coefficients[5] / a0 + Float(1);
+
+    _bShift = exponent(b0, b1, b2);
+    _dShift = exponent(d1, d2, Float(0));
+
+    // Q2.29 is Q31 of a quarter of the value
+    auto const quantize = [](Float c, int shift) {
+        auto const scale = static_cast<Float>(etl::int64_t(1) << shift) / Float(4);
+        return Q31::fromFloat(c * scale).raw();
+    };
+
+    _b0 = quantize(b0, _bShift);
+    _b1 = quantize(b1, _bShift);
+    _b2 = quantize(b2, _bShift);
+    _d1 = quantize(d1, _dShift);
+    _d2 = quantize(d2, _dShift);
+}
+
+template<etl::floating_point Float>
+auto BiquadQ31::exponent(Float a, Float b, Float c) -> int
+{
+    // Scaled below 1, so each product stays below 2^60 & the sums can't overflow.
+    auto const peak = etl::max({etl::abs(a), etl::abs(b), etl::abs(c)});
+    auto shift      = 0;
+    while (shift < 30 and peak * static_cast<Float>(etl::int64_t(2) << shift) < Float(1)) {
+        ++shift;
+    }
+    return shift;
+}
+
+inline auto BiquadQ31::reset() -> void
+{
+    _x1    = 0;
+    _x2    = 0;
+    _y1    = 0;
+    _y2    = 0;
+    _error = 0;
+}
+
+inline auto BiquadQ31::operator()(Q31 x) -> Q31
+{
+    static constexpr auto low  = etl::int64_t(etl::numeric_limits<etl::int32_t>::min());
+    static constexpr auto high = etl::int64_t(etl::numeric_limits<etl::int32_t>::max());
+
+    auto feedforward = etl::int64_t(_b0) * x.raw();
+    feedforward += etl::int64_t(_b1) * _x1;
+    feedforward += etl::int64_t(_b2) * _x2;
+
+    auto residual = etl::int64_t(_d1) * _y1;
+    residual += etl::int64_t(_d2) * _y2;
+
+    auto const integrator = (etl::int64_t(_y1) * 2 - _y2) * (etl::int64_t(1) << coefficientBits);
+    auto const acc        = _error + integrator + (feedforward >> _bShift) + (residual >> _dShift);
+
+    auto const truncated = acc >> coefficientBits;
+    auto const y         = static_cast<etl::int32_t>(etl::clamp(truncated, low, high));
+    _error               = acc - truncated * (etl::int64_t(1) << coefficientBits);
+
+    _x2 = _x1;
+    _x1 = x.raw();
+    _y2 = _y1;
+    _y1 = y;
+    return Q31::fromRaw(y);
+}
+
+inline auto BiquadQ31::process(etl::span<Q31 const> input, etl::span<Q31> output) -> void
+{
+    for (auto i = etl::size_t(0); i < input.size(); ++i) {
+        output[i] = (*this)(input[i]);
+    }
+}
+
+}  // namespace grit
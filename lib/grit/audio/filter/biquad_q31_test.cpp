@@ -0,0 +1,81 @@
+#include "biquad_q31.hpp"
+
+#include <grit/audio/filter/biquad.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+
+TEST_CASE("audio/filter: BiquadQ31")
+{
+    SECTION("bypass")
+    {
+        auto filter = grit::BiquadQ31{};
+        for (auto raw : {-2'147'483'647 - 1, -1'000, 0, 1, 12'345, 2'147'483'647}) {
+            auto const x = grit::Q31::fromRaw(static_cast<etl::int32_t>(raw));
+            REQUIRE(filter(x) == x);
+        }
+    }
+
+    SECTION("matches double Biquad")
+    {
+        // Low cutoffs at 96 kHz put the poles right next to the unit circle.
+        auto const [cutoff, q, sampleRate] = GENERATE(
+            etl::array{50.0, 0.7071, 96'000.0},
+            etl::array{100.0, 0.7071, 96'000.0},
+            etl::array{200.0, 0.71, 96'000.0},
+            etl::array{1'000.0, 4.0, 96'000.0},
+            etl::array{1'000.0, 0.7071, 48'000.0}
+        );
+        CAPTURE(cutoff, q, sampleRate);
+
+        auto const coefficients = grit::BiquadCoefficients<double>::makeLowPass(cutoff, q, sampleRate);
+
+        auto reference = grit::Biquad<double>{};
+        reference.setCoefficients(coefficients);
+
+        auto filter = grit::BiquadQ31{};
+        filter.setCoefficients(etl::span<double const, 6>{coefficients});
+
+        auto maxError = 0.0;
+        for (auto i = 0; i < 48'000; ++i) {
+            auto const t     = static_cast<double>(i) / sampleRate;
+            auto const noise = 0.2 * etl::sin(static_cast<double>(i));
+            auto const in    = grit::Q31::fromFloat(0.25 + 0.25 * etl::sin(2.0 * 3.14159265 * 30.0 * t) + noise);
+            auto const y     = filter(in).toFloat<double>();
+            maxError         = etl::max(maxError, etl::abs(y - reference(in.toFloat<double>())));
+        }
+        REQUIRE(maxError < 1e-5);
+
+        // Unity gain at DC
+        filter.reset();
+        auto y = grit::Q31{};
+        for (auto i = 0; i < 96'000; ++i) {
+            y = filter(grit::Q31::fromFloat(0.5));
+        }
+        REQUIRE(y.toFloat<double>() == Catch::Approx(0.5).margin(1e-6));
+    }
+
+    SECTION("block matches per sample")
+    {
+        auto const coefficients = grit::BiquadCoefficients<float>::makeHighPass(200.0F, 1.0F, 48'000.0F);
+
+        auto filter = grit::BiquadQ31{};
+        filter.setCoefficients(etl::span<float const, 6>{coefficients});
+        auto other = filter;
+
+        auto input = etl::array<grit::Q31, 64>{};
+        for (auto i = etl::size_t(0); i < input.size(); ++i) {
+            input[i] = grit::Q31::fromFloat(etl::sin(static_cast<float>(i) * 0.3F) * 0.9F);
+        }
+
+        auto output = etl::array<grit::Q31, 64>{};
+        other.process(input, output);
+        for (auto i = etl::size_t(0); i < input.size(); ++i) {
+            REQUIRE(output[i] == filter(input[i]));
+        }
+    }
+}
@@ -1,7 +1,9 @@
 #include "biquad.hpp"
 
+#include <etl/array.hpp>
 #include <etl/random.hpp>
 
+#include <catch2/catch_approx.hpp>
 #include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
@@ -86,3 +88,70 @@ TEMPLATE_TEST_CASE("audio/filter: Biquad", "", float, double)
         }
     }
 }
+
+TEMPLATE_TEST_CASE("audio/filter: Biquad::process", "", float, double)
+{
+    using Float  = TestType;
+    using Filter = grit::Biquad<Float>;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto const q  = Float(1) / etl::sqrt(Float(2));
+    auto const lp = Filter::Coefficients::makeLowPass(Float(1000), q, Float(48000));
+
+    auto reference = Filter{};
+    auto block     = Filter{};
+    reference.setCoefficients(lp);
+    block.setCoefficients(lp);
+
+    for (auto b{0}; b < 16; ++b) {
+        auto buffer = etl::array<Float, 32>{};
+        etl::generate(buffer.begin(), buffer.end(), [&] { return dist(rng); });
+
+        auto expected = buffer;
+        for (auto& x : expected) {
+            x = reference(x);
+        }
+
+        block.process(buffer, buffer);
+        for (auto i = size_t(0); i < buffer.size(); ++i) {
+            REQUIRE(buffer[i] == Catch::Approx(expected[i]));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/filter: Biquad<StereoFrame>", "", float, double)
+{
+    using Float = TestType;
+    using Frame = grit::StereoFrame<Float>;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto const q  = Float(1) / etl::sqrt(Float(2));
+    auto const lp = grit::BiquadCoefficients<Float>::makeLowPass(Float(1000), q, Float(48000));
+
+    auto left   = grit::Biquad<Float>{};
+    auto right  = grit::Biquad<Float>{};
+    auto packed = grit::Biquad<Frame>{};
+    left.setCoefficients(lp);
+    right.setCoefficients(lp);
+    packed.setCoefficients(lp);
+
+    auto buffer = etl::array<Frame, 32>{};
+    for (auto b{0}; b < 16; ++b) {
+        etl::generate(buffer.begin(), buffer.end(), [&] { return Frame{dist(rng), dist(rng)}; });
+
+        auto expected = buffer;
+        for (auto& x : expected) {
+            x = Frame{left(x.left), right(x.right)};
+        }
+
+        packed.process(buffer, buffer);
+        for (auto i = size_t(0); i < buffer.size(); ++i) {
+            REQUIRE(buffer[i].left == Catch::Approx(expected[i].left));
+            REQUIRE(buffer[i].right == Catch::Approx(expected[i].right));
+        }
+    }
+}
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <grit/audio/stereo/stereo_frame.hpp>
+
 #include <etl/cmath.hpp>
 #include <etl/concepts.hpp>
 #include <etl/cstdint.hpp>
 #include <etl/numbers.hpp>
+#include <etl/span.hpp>
 #include <etl/type_traits.hpp>
 
 namespace grit {
@@ -21,91 +24,134 @@ enum struct StateVariableFilterType : etl::uint8_t
 
 /// \brief State variable filter
 /// \details https://cytomic.com/files/dsp/SvfLinearTrapAllOutputs.pdf
+///
+/// With a StereoFrame sample both channels share the parameters, the filter
+/// state is packed into the left/right lanes.
 /// \ingroup grit-audio-filter
-template<etl::floating_point Float, StateVariableFilterType Type>
+template<audio_sample Sample, StateVariableFilterType Type>
 struct StateVariableFilter
 {
-    using SampleType = Float;
+    using SampleType = Sample;
+    using ValueType  = SampleValueType<Sample>;
 
     struct Parameter
     {
-        Float cutoff    = Float(440);
-        Float resonance = Float(1) / etl::sqrt(Float(2));
+        ValueType cutoff    = ValueType(440);
+        ValueType resonance = ValueType(1) / etl::sqrt(ValueType(2));
     };
 
     StateVariableFilter() = default;
 
     auto setParameter(Parameter const& parameter) -> void;
-    auto setSampleRate(Float sampleRate) -> void;
-    auto operator()(Float x) -> Float;
+    auto setSampleRate(ValueType sampleRate) -> void;
+    auto operator()(Sample x) -> Sample;
     auto reset() -> void;
 
+    /// Processes a block of samples. Equivalent to calling operator() on every sample.
+    /// \pre input.size() == output.size(), input & output may alias
+    auto process(etl::span<Sample const> input, etl::span<Sample> output) -> void;
+
 private:
     auto update() -> void;
+    [[nodiscard]] static auto
+    tick(Sample x, ValueType g, ValueType k, ValueType gt0, ValueType gk0, Sample& ic1eq, Sample& ic2eq) -> Sample;
 
     Parameter _parameter{};
-    Float _sampleRate{0};
+    ValueType _sampleRate{0};
 
-    Float _g{0};
-    Float _k{0};
-    Float _gt0{0};
-    Float _gk0{0};
+    ValueType _g{0};
+    ValueType _k{0};
+    ValueType _gt0{0};
+    ValueType _gk0{0};
 
-    Float _ic1eq{0};
-    Float _ic2eq{0};
+    Sample _ic1eq{};
+    Sample _ic2eq{};
 };
 
 /// \ingroup grit-audio-filter
-template<etl::floating_point Float>
-using StateVariableHighpass = StateVariableFilter<Float, StateVariableFilterType::Highpass>;
+template<audio_sample Sample>
+using StateVariableHighpass = StateVariableFilter<Sample, StateVariableFilterType::Highpass>;
 
 /// \ingroup grit-audio-filter
-template<etl::floating_point Float>
-using StateVariableBandpass = StateVariableFilter<Float, StateVariableFilterType::Bandpass>;
+template<audio_sample Sample>
+using StateVariableBandpass = StateVariableFilter<Sample, StateVariableFilterType::Bandpass>;
 
 /// \ingroup grit-audio-filter
-template<etl::floating_point Float>
-using StateVariableLowpass = StateVariableFilter<Float, StateVariableFilterType::Lowpass>;
+template<audio_sample Sample>
+using StateVariableLowpass = StateVariableFilter<Sample, StateVariableFilterType::Lowpass>;
 
 /// \ingroup grit-audio-filter
-template<etl::floating_point Float>
-using StateVariableNotch = StateVariableFilter<Float, StateVariableFilterType::Notch>;
+template<audio_sample Sample>
+using StateVariableNotch = StateVariableFilter<Sample, StateVariableFilterType::Notch>;
 
 /// \ingroup grit-audio-filter
-template<etl::floating_point Float>
-using StateVariablePeak = StateVariableFilter<Float, StateVariableFilterType::Peak>;
+template<audio_sample Sample>
+using StateVariablePeak = StateVariableFilter<Sample, StateVariableFilterType::Peak>;
 
 /// \ingroup grit-audio-filter
-template<etl::floating_point Float>
-using StateVariableAllpass = StateVariableFilter<Float, StateVariableFilterType::Allpass>;
+template<audio_sample Sample>
+using StateVariableAllpass = StateVariableFilter<Sample, StateVariableFilterType::Allpass>;
 
-template<etl::floating_point Float, StateVariableFilterType Type>
-auto StateVariableFilter<Float, Type>::setParameter(Parameter const& parameter) -> void
+template<audio_sample Sample, StateVariableFilterType Type>
+auto StateVariableFilter<Sample, Type>::setParameter(Parameter const& parameter) -> void
 {
     _parameter = parameter;
     update();
 }
 
-template<etl::floating_point Float, StateVariableFilterType Type>
-auto StateVariableFilter<Float, Type>::setSampleRate(Float sampleRate) -> void
+template<audio_sample Sample, StateVariableFilterType Type>
+auto StateVariableFilter<Sample, Type>::setSampleRate(ValueType sampleRate) -> void
 {
     _sampleRate = sampleRate;
     update();
     reset();
 }
 
-template<etl::floating_point Float, StateVariableFilterType Type>
-auto StateVariableFilter<Float, Type>::operator()(Float x) -> Float
+template<audio_sample Sample, StateVariableFilterType Type>
+auto StateVariableFilter<Sample, Type>::operator()(Sample x) -> Sample
+{
+    return tick(x, _g, _k, _gt0, _gk0, _ic1eq, _ic2eq);
+}
+
+template<audio_sample Sample, StateVariableFilterType Type>
+auto StateVariableFilter<Sample, Type>::process(etl::span<Sample const> input, etl::span<Sample> output) -> void
+{
+    auto const g   = _g;
+    auto const k   = _k;
+    auto const gt0 = _gt0;
+    auto const gk0 = _gk0;
+
+    auto ic1eq = _ic1eq;
+    auto ic2eq = _ic2eq;
+
+    for (auto i = etl::size_t(0); i < input.size(); ++i) {
+        output[i] = tick(input[i], g, k, gt0, gk0, ic1eq, ic2eq);
+    }
+
+    _ic1eq = ic1eq;
+    _ic2eq = ic2eq;
+}
+
+template<audio_sample Sample, StateVariableFilterType Type>
+auto StateVariableFilter<Sample, Type>::tick(
+    Sample x,
+    ValueType g,
+    [[maybe_unused]] ValueType k,
+    ValueType gt0,
+    ValueType gk0,
+    Sample& ic1eq,
+    Sample& ic2eq
+) -> Sample
 {
-    auto const t0 = x - _ic2eq;
-    auto const v0 = _gt0 * t0 - _gk0 * _ic1eq;
-    auto const t1 = _g * v0;
-    auto const v1 = _ic1eq + t1;
-    auto const t2 = _g * v1;
-    auto const v2 = _ic2eq + t2;
+    auto const t0 = x - ic2eq;
+    auto const v0 = gt0 * t0 - gk0 * ic1eq;
+    auto const t1 = g * v0;
+    auto const v1 = ic1eq + t1;
+    auto const t2 = g * v1;
+    auto const v2 = ic2eq + t2;
 
-    _ic1eq = v1 + t1;
-    _ic2eq = v2 + t2;
+    ic1eq = v1 + t1;
+    ic2eq = v2 + t2;
 
     if constexpr (Type == StateVariableFilterType::Highpass) {
         return v0;
@@ -118,23 +164,23 @@ auto StateVariableFilter<Float, Type>::operator()(Float x) -> Float
     } else if constexpr (Type == StateVariableFilterType::Peak) {
         return v0 - v2;
     } else if constexpr (Type == StateVariableFilterType::Allpass) {
-        return v0 - _k * v1 + v2;
+        return v0 - k * v1 + v2;
     } else {
         static_assert(etl::always_false<decltype(Type)>);
     }
 }
 
-template<etl::floating_point Float, StateVariableFilterType Type>
-auto StateVariableFilter<Float, Type>::reset() -> void
+template<audio_sample Sample, StateVariableFilterType Type>
+auto StateVariableFilter<Sample, Type>::reset() -> void
 {
-    _ic1eq = Float(0);
-    _ic2eq = Float(0);
+    _ic1eq = Sample{};
+    _ic2eq = Sample{};
 }
 
-template<etl::floating_point Float, StateVariableFilterType Type>
-auto StateVariableFilter<Float, Type>::update() -> void
+template<audio_sample Sample, StateVariableFilterType Type>
+auto StateVariableFilter<Sample, Type>::update() -> void
 {
-    auto w = static_cast<Float>(etl::numbers::pi) * _parameter.cutoff / _sampleRate;
+    auto w = static_cast<ValueType>(etl::numbers::pi) * _parameter.cutoff / _sampleRate;
     _g     = etl::tan(w);
     _k     = 1 / _parameter.resonance;
 
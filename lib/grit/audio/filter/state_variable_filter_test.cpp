@@ -1,7 +1,10 @@
 #include "state_variable_filter.hpp"
 
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
 #include <etl/random.hpp>
 
+#include <catch2/catch_approx.hpp>
 #include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
@@ -43,3 +46,77 @@ TEMPLATE_PRODUCT_TEST_CASE(
         REQUIRE(etl::isfinite(y));
     }
 }
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "audio/filter: StateVariableFilter::process",
+    "",
+    (grit::StateVariableHighpass,
+     grit::StateVariableBandpass,
+     grit::StateVariableLowpass,
+     grit::StateVariableNotch,
+     grit::StateVariablePeak,
+     grit::StateVariableAllpass),
+    (float, double)
+)
+{
+    using Filter = TestType;
+    using Float  = typename Filter::SampleType;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(1)};
+
+    auto const fs = GENERATE(Float(24000), Float(48000), Float(96000));
+    auto const parameter = typename Filter::Parameter{.cutoff = Float(fs * 0.1)};
+
+    auto reference = Filter{};
+    reference.setSampleRate(fs);
+    reference.setParameter(parameter);
+
+    auto block = Filter{};
+    block.setSampleRate(fs);
+    block.setParameter(parameter);
+
+    for (auto b{0}; b < 16; ++b) {
+        auto buffer = etl::array<Float, 32>{};
+        etl::generate(buffer.begin(), buffer.end(), [&] { return dist(rng); });
+
+        auto expected = buffer;
+        for (auto& x : expected) {
+            x = reference(x);
+        }
+
+        block.process(buffer, buffer);
+        for (auto i = size_t(0); i < buffer.size(); ++i) {
+            REQUIRE(buffer[i] == Catch::Approx(expected[i]));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/filter: StateVariableFilter<StereoFrame>", "", float, double)
+{
+    using Float = TestType;
+    using Frame = grit::StereoFrame<Float>;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(1)};
+
+    auto const fs        = Float(48000);
+    auto const parameter = typename grit::StateVariableBandpass<Float>::Parameter{.cutoff = Float(fs * 0.1)};
+
+    auto left   = grit::StateVariableBandpass<Float>{};
+    auto right  = grit::StateVariableBandpass<Float>{};
+    auto packed = grit::StateVariableBandpass<Frame>{};
+    left.setSampleRate(fs);
+    right.setSampleRate(fs);
+    packed.setSampleRate(fs);
+    left.setParameter(parameter);
+    right.setParameter(parameter);
+    packed.setParameter({.cutoff = parameter.cutoff, .resonance = parameter.resonance});
+
+    for (auto i{0}; i < 1'000; ++i) {
+        auto const x = Frame{dist(rng), dist(rng)};
+        auto const y = packed(x);
+        REQUIRE(y.left == Catch::Approx(left(x.left)));
+        REQUIRE(y.right == Catch::Approx(right(x.right)));
+    }
+}
@@ -4,3 +4,4 @@
 /// \ingroup grit-audio
 
 #include <grit/audio/mix/cross_fade.hpp>
+#include <grit/audio/mix/gain_q15.hpp>
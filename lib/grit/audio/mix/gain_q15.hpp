@@ -0,0 +1,58 @@
+#pragma once
+
+#include <grit/core/arm.hpp>
+#include <grit/math/fixed_point.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/concepts.hpp>
+#include <etl/cstdint.hpp>
+#include <etl/span.hpp>
+
+namespace grit {
+
+/// \brief Q15 gain stage with saturation.
+/// \details The gain is stored in Q4.11, so it covers [0, 16) or up to +24 dB.
+/// \ingroup grit-audio-mix
+struct GainQ15
+{
+    using SampleType = Q15;
+
+    static constexpr auto gainBits = 11;
+
+    GainQ15() = default;
+
+    /// Linear gain, clamped to [0, 16).
+    template<etl::floating_point Float>
+    auto setGain(Float gain) -> void;
+
+    [[nodiscard]] auto operator()(Q15 x) const -> Q15;
+
+    /// Processes a block of samples. Equivalent to calling operator() on every sample.
+    /// \pre input.size() == output.size(), input & output may alias
+    auto process(etl::span<Q15 const> input, etl::span<Q15> output) const -> void;
+
+private:
+    etl::int32_t _gain{1 << gainBits};
+};
+
+template<etl::floating_point Float>
+auto GainQ15::setGain(Float gain) -> void
+{
+    auto const scaled = static_cast<Float>(gain) * static_cast<Float>(1 << gainBits) + Float(0.5);
+    _gain             = static_cast<etl::int32_t>(etl::clamp(scaled, Float(0), static_cast<Float>(TA_Q15_MAX)));
+}
+
+inline auto GainQ15::operator()(Q15 x) const -> Q15
+{
+    static constexpr auto round = etl::int32_t(1) << (gainBits - 1);
+    return Q15::fromRaw(arm::ssat16((x.raw() * _gain + round) >> gainBits));
+}
+
+inline auto GainQ15::process(etl::span<Q15 const> input, etl::span<Q15> output) const -> void
+{
+    for (auto i = etl::size_t(0); i < input.size(); ++i) {
+        output[i] = (*this)(input[i]);
+    }
+}
+
+}  // namespace grit
@@ -0,0 +1,20 @@
+#include "gain_q15.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("audio/mix: GainQ15")
+{
+    auto gain = grit::GainQ15{};
+    REQUIRE(gain(grit::Q15::fromFloat(0.25)) == grit::Q15::fromFloat(0.25));
+
+    gain.setGain(0.5F);
+    REQUIRE(gain(grit::Q15::fromFloat(0.25)) == grit::Q15::fromFloat(0.125));
+
+    gain.setGain(4.0F);
+    REQUIRE(gain(grit::Q15::fromFloat(0.125)) == grit::Q15::fromFloat(0.5));
+    REQUIRE(gain(grit::Q15::fromFloat(0.5)).raw() == 32'767);
+    REQUIRE(gain(grit::Q15::fromFloat(-0.5)).raw() == -32'768);
+
+    gain.setGain(100.0F);
+    REQUIRE(gain(grit::Q15::fromRaw(1)).raw() == 16);
+}
@@ -3,6 +3,11 @@
 /// \defgroup grit-audio-oscillator Oscillator
 /// \ingroup grit-audio
 
+#include <grit/audio/oscillator/mipmapped_morphing_wavetable_oscillator.hpp>
+#include <grit/audio/oscillator/mipmapped_wavetable.hpp>
+#include <grit/audio/oscillator/mipmapped_wavetable_oscillator.hpp>
+#include <grit/audio/oscillator/morphing_wavetable_oscillator.hpp>
 #include <grit/audio/oscillator/oscillator.hpp>
+#include <grit/audio/oscillator/poly_blep.hpp>
 #include <grit/audio/oscillator/variable_shape_oscillator.hpp>
 #include <grit/audio/oscillator/wavetable_oscillator.hpp>
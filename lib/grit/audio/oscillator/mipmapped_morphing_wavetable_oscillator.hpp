@@ -0,0 +1,155 @@
+#pragma once
+
+#include <grit/audio/oscillator/mipmapped_wavetable.hpp>
+#include <grit/math/hermite_interpolation.hpp>
+#include <grit/math/linear_interpolation.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/cmath.hpp>
+#include <etl/concepts.hpp>
+#include <etl/span.hpp>
+
+namespace grit {
+
+/// \brief Wavetable oscillator morphing between frames, each band-limited with a MipmappedWavetable.
+///
+/// \details Combines MorphingWavetableOscillator & MipmappedWavetableOscillator.
+/// setShapeMorph() picks the frame pair & crossfade, setFrequency() the two
+/// neighbouring levels & their crossfade, so call both once per block. Per
+/// sample the four hermite taps are crossfaded between the frames on both
+/// levels, followed by one hermite evaluation per level & a lerp. Phase
+/// modulation via addPhaseOffset() doesn't change the selected levels.
+///
+/// \ingroup grit-audio-oscillator
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize, etl::size_t Levels>
+struct MipmappedMorphingWavetableOscillator
+{
+    static_assert(Frames >= 1);
+
+    using Wavetable = MipmappedWavetable<Float, TableSize, Levels>;
+
+    /// The frames are referenced, not copied.
+    explicit MipmappedMorphingWavetableOscillator(etl::span<Wavetable const, Frames> frames);
+
+    /// 0 is the first frame, 1 the last.
+    auto setShapeMorph(Float morph) -> void;
+
+    auto setPhase(Float phase) -> void;
+    auto setFrequency(Float frequency) -> void;
+    auto setSampleRate(Float sampleRate) -> void;
+
+    auto addPhaseOffset(Float offset) -> void;
+
+    [[nodiscard]] auto operator()() -> Float;
+
+private:
+    using Table = typename Wavetable::Table;
+
+    auto selectTables() -> void;
+
+    Float _sampleRate{0};
+    Float _phase{0};
+    Float _phaseIncrement{0};
+    Float _morphFade{0};
+    Float _levelFade{0};
+    etl::size_t _frame{0};
+    etl::size_t _nextFrame{0};
+    etl::size_t _level{0};
+    etl::size_t _nextLevel{0};
+
+    // Current & next frame on the lower & upper level
+    Table _lower;
+    Table _lowerNext;
+    Table _upper;
+    Table _upperNext;
+
+    etl::span<Wavetable const, Frames> _frames;
+};
+
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize, etl::size_t Levels>
+MipmappedMorphingWavetableOscillator<Float, Frames, TableSize, Levels>::MipmappedMorphingWavetableOscillator(
+    etl::span<Wavetable const, Frames> frames
+)
+    : _lower{frames[0].table(0)}
+    , _lowerNext{frames[0].table(0)}
+    , _upper{frames[0].table(0)}
+    , _upperNext{frames[0].table(0)}
+    , _frames{frames}
+{}
+
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize, etl::size_t Levels>
+auto MipmappedMorphingWavetableOscillator<Float, Frames, TableSize, Levels>::setShapeMorph(Float morph) -> void
+{
+    auto const position = etl::clamp(morph, Float(0), Float(1)) * static_cast<Float>(Frames - 1);
+
+    _frame     = etl::min(static_cast<etl::size_t>(position), Frames - 1);
+    _nextFrame = etl::min(_frame + 1, Frames - 1);
+    _morphFade = position - static_cast<Float>(_frame);
+    selectTables();
+}
+
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize, etl::size_t Levels>
+auto MipmappedMorphingWavetableOscillator<Float, Frames, TableSize, Levels>::setPhase(Float phase) -> void
+{
+    _phase = phase;
+}
+
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize, etl::size_t Levels>
+auto MipmappedMorphingWavetableOscillator<Float, Frames, TableSize, Levels>::setFrequency(Float frequency) -> void
+{
+    _phaseIncrement = 1.0F / (_sampleRate / frequency);
+
+    auto const level = Wavetable::level(_phaseIncrement);
+
+    _level     = static_cast<etl::size_t>(level);
+    _nextLevel = etl::min(_level + 1, Levels - 1);
+    _levelFade = level - static_cast<Float>(_level);
+    selectTables();
+}
+
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize, etl::size_t Levels>
+auto MipmappedMorphingWavetableOscillator<Float, Frames, TableSize, Levels>::setSampleRate(Float sampleRate) -> void
+{
+    _sampleRate = sampleRate;
+}
+
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize, etl::size_t Levels>
+auto MipmappedMorphingWavetableOscillator<Float, Frames, TableSize, Levels>::addPhaseOffset(Float offset) -> void
+{
+    _phase += offset;
+    _phase -= etl::floor(_phase);
+}
+
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize, etl::size_t Levels>
+auto MipmappedMorphingWavetableOscillator<Float, Frames, TableSize, Levels>::operator()() -> Float
+{
+    static constexpr auto mask = TableSize - 1;
+
+    auto const scaledPhase  = _phase * static_cast<Float>(TableSize);
+    auto const sampleIndex  = static_cast<etl::size_t>(scaledPhase);
+    auto const sampleOffset = scaledPhase - static_cast<Float>(sampleIndex);
+    addPhaseOffset(_phaseIncrement);
+
+    auto const interpolate = [this, sampleIndex, sampleOffset](Table frame, Table next) {
+        auto const tap = [=, this](etl::size_t offset) {
+            auto const index = (sampleIndex + TableSize + offset - 1) & mask;
+            return linearInterpolation(frame(index), next(index), _morphFade);
+        };
+        return hermiteInterpolation(tap(0), tap(1), tap(2), tap(3), sampleOffset);
+    };
+
+    auto const lower = interpolate(_lower, _lowerNext);
+    auto const upper = interpolate(_upper, _upperNext);
+    return linearInterpolation(lower, upper, _levelFade);
+}
+
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize, etl::size_t Levels>
+auto MipmappedMorphingWavetableOscillator<Float, Frames, TableSize, Levels>::selectTables() -> void
+{
+    _lower     = _frames[_frame].table(_level);
+    _lowerNext = _frames[_nextFrame].table(_level);
+    _upper     = _frames[_frame].table(_nextLevel);
+    _upperNext = _frames[_nextFrame].table(_nextLevel);
+}
+
+}  // namespace grit
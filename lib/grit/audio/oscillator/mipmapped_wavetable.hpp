@@ -0,0 +1,98 @@
+#pragma once
+
+#include <grit/fft/real_plan.hpp>
+#include <grit/math/ilog2.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/bit.hpp>
+#include <etl/cmath.hpp>
+#include <etl/complex.hpp>
+#include <etl/concepts.hpp>
+#include <etl/cstddef.hpp>
+#include <etl/mdspan.hpp>
+#include <etl/span.hpp>
+
+namespace grit {
+
+/// \brief Single cycle waveform, band-limited into one table per octave.
+///
+/// \details Level l keeps the first TableSize/2^(l+1) harmonics, so level 0
+/// is the full waveform and every following level has half the bandwidth.
+/// Use level(phaseIncrement) to find the tables that don't alias for a given
+/// pitch.
+///
+/// \ingroup grit-audio-oscillator
+template<etl::floating_point Float, etl::size_t TableSize, etl::size_t Levels>
+struct MipmappedWavetable
+{
+    static_assert(etl::has_single_bit(TableSize));
+    static_assert(Levels >= 1 and Levels < ilog2(TableSize));
+
+    using SampleType = Float;
+    using Table      = etl::mdspan<Float const, etl::extents<etl::size_t, TableSize>>;
+
+    MipmappedWavetable() = default;
+
+    [[nodiscard]] static constexpr auto tableSize() -> etl::size_t { return TableSize; }
+
+    [[nodiscard]] static constexpr auto levels() -> etl::size_t { return Levels; }
+
+    /// Number of harmonics kept in the given level.
+    [[nodiscard]] static constexpr auto harmonics(etl::size_t level) -> etl::size_t { return TableSize >> (level + 1); }
+
+    /// Continuous level for a phase increment in cycles per sample. Every level
+    /// from floor(level) upwards is free of aliasing, floor(level) keeps at
+    /// least a quarter of the sample rate.
+    [[nodiscard]] static auto level(Float phaseIncrement) -> Float;
+
+    /// Band-limits the waveform into all levels. Runs one forward and levels()
+    /// backward ffts, don't call it on the audio thread.
+    auto setWaveform(etl::span<Float const, TableSize> waveform) -> void;
+
+    [[nodiscard]] auto table(etl::size_t level) const -> Table;
+
+private:
+    etl::array<Float, TableSize * Levels> _tables{};
+};
+
+template<etl::floating_point Float, etl::size_t TableSize, etl::size_t Levels>
+auto MipmappedWavetable<Float, TableSize, Levels>::level(Float phaseIncrement) -> Float
+{
+    // harmonics(l) * increment <= 0.5 for l >= log2(TableSize * increment). The
+    // extra octave keeps the table above floor(level) in range as well.
+    auto const l = etl::log2(etl::abs(phaseIncrement) * static_cast<Float>(TableSize)) + Float(1);
+    return etl::clamp(l, Float(0), static_cast<Float>(Levels - 1));
+}
+
+template<etl::floating_point Float, etl::size_t TableSize, etl::size_t Levels>
+auto MipmappedWavetable<Float, TableSize, Levels>::setWaveform(etl::span<Float const, TableSize> waveform) -> void
+{
+    using Plan    = fft::RealPlan<Float, TableSize>;
+    using Complex = etl::complex<Float>;
+
+    auto plan     = Plan{};
+    auto spectrum = etl::array<Complex, Plan::numBins()>{};
+    auto bins     = etl::mdspan{spectrum.data(), etl::extents<etl::size_t, Plan::numBins()>{}};
+
+    plan(etl::mdspan{waveform.data(), etl::extents<etl::size_t, TableSize>{}}, bins);
+
+    // The backward fft is unnormalized.
+    auto const scale = Float(1) / static_cast<Float>(TableSize);
+    etl::transform(spectrum.begin(), spectrum.end(), spectrum.begin(), [scale](auto x) { return x * scale; });
+
+    // Every level has fewer harmonics than the previous one, so the spectrum
+    // is truncated in place.
+    for (auto l = etl::size_t(0); l < Levels; ++l) {
+        etl::fill(spectrum.begin() + static_cast<etl::ptrdiff_t>(harmonics(l) + 1), spectrum.end(), Complex{});
+        plan(bins, etl::mdspan{_tables.data() + l * TableSize, etl::extents<etl::size_t, TableSize>{}});
+    }
+}
+
+template<etl::floating_point Float, etl::size_t TableSize, etl::size_t Levels>
+auto MipmappedWavetable<Float, TableSize, Levels>::table(etl::size_t level) const -> Table
+{
+    return Table{_tables.data() + level * TableSize};
+}
+
+}  // namespace grit
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <grit/audio/oscillator/mipmapped_wavetable.hpp>
+#include <grit/math/buffer_interpolation.hpp>
+#include <grit/math/linear_interpolation.hpp>
+
+#include <etl/cmath.hpp>
+#include <etl/concepts.hpp>
+
+namespace grit {
+
+/// \brief Wavetable oscillator reading from a MipmappedWavetable.
+///
+/// \details setFrequency() picks the two neighbouring levels for the pitch
+/// and the crossfade between them. Both are held until the next frequency
+/// change, so the per sample cost is two hermite fetches and a lerp.
+/// Phase modulation via addPhaseOffset() doesn't change the selected level.
+///
+/// \ingroup grit-audio-oscillator
+template<etl::floating_point Float, etl::size_t TableSize, etl::size_t Levels>
+struct MipmappedWavetableOscillator
+{
+    using Wavetable = MipmappedWavetable<Float, TableSize, Levels>;
+
+    explicit MipmappedWavetableOscillator(Wavetable const& wavetable);
+
+    auto setPhase(Float phase) -> void;
+    auto setFrequency(Float frequency) -> void;
+    auto setSampleRate(Float sampleRate) -> void;
+
+    auto addPhaseOffset(Float offset) -> void;
+
+    [[nodiscard]] auto operator()() -> Float;
+
+private:
+    Float _sampleRate{0};
+    Float _phase{0};
+    Float _phaseIncrement{0};
+    Float _fade{0};
+    typename Wavetable::Table _lower;
+    typename Wavetable::Table _upper;
+    Wavetable const* _wavetable;
+};
+
+template<etl::floating_point Float, etl::size_t TableSize, etl::size_t Levels>
+MipmappedWavetableOscillator<Float, TableSize, Levels>::MipmappedWavetableOscillator(Wavetable const& wavetable)
+    : _lower{wavetable.table(0)}
+    , _upper{wavetable.table(0)}
+    , _wavetable{&wavetable}
+{}
+
+template<etl::floating_point Float, etl::size_t TableSize, etl::size_t Levels>
+auto MipmappedWavetableOscillator<Float, TableSize, Levels>::setPhase(Float phase) -> void
+{
+    _phase = phase;
+}
+
+template<etl::floating_point Float, etl::size_t TableSize, etl::size_t Levels>
+auto MipmappedWavetableOscillator<Float, TableSize, Levels>::setFrequency(Float frequency) -> void
+{
+    _phaseIncrement = 1.0F / (_sampleRate / frequency);
+
+    auto const level = Wavetable::level(_phaseIncrement);
+    auto const lower = static_cast<etl::size_t>(level);
+    auto const upper = etl::min(lower + 1, Levels - 1);
+
+    _fade  = level - static_cast<Float>(lower);
+    _lower = _wavetable->table(lower);
+    _upper = _wavetable->table(upper);
+}
+
+template<etl::floating_point Float, etl::size_t TableSize, etl::size_t Levels>
+auto MipmappedWavetableOscillator<Float, TableSize, Levels>::setSampleRate(Float sampleRate) -> void
+{
+    _sampleRate = sampleRate;
+}
+
+template<etl::floating_point Float, etl::size_t TableSize, etl::size_t Levels>
+auto MipmappedWavetableOscillator<Float, TableSize, Levels>::addPhaseOffset(Float offset) -> void
+{
+    _phase += offset;
+    _phase -= etl::floor(_phase);
+}
+
+template<etl::floating_point Float, etl::size_t TableSize, etl::size_t Levels>
+auto MipmappedWavetableOscillator<Float, TableSize, Levels>::operator()() -> Float
+{
+    auto const scaledPhase  = _phase * static_cast<Float>(TableSize);
+    auto const sampleIndex  = static_cast<etl::size_t>(scaledPhase);
+    auto const sampleOffset = scaledPhase - static_cast<Float>(sampleIndex);
+    addPhaseOffset(_phaseIncrement);
+
+    auto const lower = BufferInterpolation::Hermite{}(_lower, sampleIndex, sampleOffset);
+    auto const upper = BufferInterpolation::Hermite{}(_upper, sampleIndex, sampleOffset);
+    return linearInterpolation(lower, upper, _fade);
+}
+
+}  // namespace grit
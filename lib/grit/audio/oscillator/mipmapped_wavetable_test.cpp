@@ -0,0 +1,195 @@
+#include "mipmapped_morphing_wavetable_oscillator.hpp"
+#include "mipmapped_wavetable.hpp"
+#include "mipmapped_wavetable_oscillator.hpp"
+#include "morphing_wavetable_oscillator.hpp"
+#include "wavetable_oscillator.hpp"
+
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/complex.hpp>
+#include <etl/mdspan.hpp>
+#include <etl/numbers.hpp>
+#include <etl/utility.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+namespace {
+
+inline constexpr auto tableSize  = etl::size_t(256);
+inline constexpr auto numLevels  = etl::size_t(6);
+inline constexpr auto sampleRate = 48'000.0;
+
+template<typename Float>
+[[nodiscard]] auto makeSawtooth() -> etl::array<Float, tableSize>
+{
+    auto table = etl::array<Float, tableSize>{};
+    for (auto i = etl::size_t(0); i < tableSize; ++i) {
+        table[i] = Float(2) * static_cast<Float>(i) / static_cast<Float>(tableSize) - Float(1);
+    }
+    return table;
+}
+
+// Energy away from the harmonics of the tone is aliasing.
+template<typename Oscillator>
+[[nodiscard]] auto aliasing(Oscillator& osc, double frequency) -> double
+{
+    static constexpr auto fftSize = etl::size_t(4096);
+
+    osc.setSampleRate(sampleRate);
+    osc.setFrequency(frequency);
+
+    auto samples = etl::array<double, fftSize>{};
+    auto bins    = etl::array<etl::complex<double>, fftSize / 2 + 1>{};
+    for (auto i = etl::size_t(0); i < fftSize; ++i) {
+        auto const window = 0.5 - 0.5 * etl::cos(2.0 * etl::numbers::pi * double(i) / double(fftSize));
+        samples[i]        = osc() * window;
+    }
+
+    auto plan = grit::fft::RealPlan<double, fftSize>{};
+    plan(etl::mdspan{samples.data(), etl::extents{fftSize}}, etl::mdspan{bins.data(), etl::extents{bins.size()}});
+
+    auto const binWidth = sampleRate / double(fftSize);
+    auto energy         = 0.0;
+    for (auto k = etl::size_t(0); k < bins.size(); ++k) {
+        auto const f        = double(k) * binWidth;
+        auto const harmonic = etl::round(f / frequency) * frequency;
+        if (etl::abs(f - harmonic) > binWidth * 4.0) {
+            energy += etl::norm(bins[k]);
+        }
+    }
+    return energy;
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("audio/oscillator: MipmappedWavetable", "", float, double)
+{
+    using Float     = TestType;
+    using Wavetable = grit::MipmappedWavetable<Float, tableSize, numLevels>;
+    using Plan      = grit::fft::RealPlan<Float, tableSize>;
+
+    STATIC_REQUIRE(Wavetable::tableSize() == tableSize);
+    STATIC_REQUIRE(Wavetable::levels() == numLevels);
+    STATIC_REQUIRE(Wavetable::harmonics(0) == tableSize / 2);
+    STATIC_REQUIRE(Wavetable::harmonics(1) == tableSize / 4);
+
+    REQUIRE(Wavetable::level(Float(0)) == Catch::Approx(0));
+    REQUIRE(Wavetable::level(Float(0.5) / Float(tableSize)) == Catch::Approx(0));
+    REQUIRE(Wavetable::level(Float(1) / Float(tableSize)) == Catch::Approx(1));
+    REQUIRE(Wavetable::level(Float(4) / Float(tableSize)) == Catch::Approx(3));
+    REQUIRE(Wavetable::level(Float(6) / Float(tableSize)) == Catch::Approx(etl::log2(6.0) + 1.0));
+    REQUIRE(Wavetable::level(Float(0.5)) == Catch::Approx(numLevels - 1));
+
+    auto const saw = makeSawtooth<Float>();
+    auto wavetable = Wavetable{};
+    wavetable.setWaveform(saw);
+
+    auto const tolerance = etl::same_as<Float, float> ? 1e-4 : 1e-9;
+
+    auto plan     = Plan{};
+    auto spectrum = etl::array<etl::complex<Float>, Plan::numBins()>{};
+    auto input    = etl::array<Float, tableSize>{};
+    for (auto level = etl::size_t(0); level < numLevels; ++level) {
+        auto const table = wavetable.table(level);
+        for (auto i = etl::size_t(0); i < tableSize; ++i) {
+            input[i] = table(i);
+        }
+        auto bins = etl::mdspan{spectrum.data(), etl::extents{Plan::numBins()}};
+        plan(etl::mdspan{input.data(), etl::extents{tableSize}}, bins);
+
+        // A sawtooth has a 1/k spectrum, so every kept harmonic is non-zero.
+        for (auto k = etl::size_t(1); k < spectrum.size(); ++k) {
+            CAPTURE(level, k);
+            if (k <= Wavetable::harmonics(level)) {
+                REQUIRE(etl::abs(spectrum[k]) > Float(0.1));
+            } else {
+                REQUIRE_THAT(etl::abs(spectrum[k]), Catch::Matchers::WithinAbs(0, tolerance));
+            }
+        }
+    }
+
+    // Level 0 is the full waveform.
+    for (auto i = etl::size_t(0); i < tableSize; ++i) {
+        REQUIRE_THAT(wavetable.table(0)(i), Catch::Matchers::WithinAbs(saw[i], tolerance));
+    }
+}
+
+TEST_CASE("audio/oscillator: MipmappedWavetableOscillator")
+{
+    using Wavetable = grit::MipmappedWavetable<double, tableSize, numLevels>;
+
+    auto const saw = makeSawtooth<double>();
+    auto mipmap    = Wavetable{};
+    mipmap.setWaveform(saw);
+
+    for (auto const frequency : {1'234.5, 2'637.3, 5'111.1}) {
+        auto mipmapped = grit::MipmappedWavetableOscillator<double, tableSize, numLevels>{mipmap};
+        auto naive     = grit::WavetableOscillator<double, tableSize>{etl::mdspan{saw.data(), etl::extents{tableSize}}};
+
+        auto const bandLimited = aliasing(mipmapped, frequency);
+        auto const reference   = aliasing(naive, frequency);
+
+        CAPTURE(frequency, bandLimited, reference);
+        REQUIRE(bandLimited < reference * 0.01);
+    }
+}
+
+TEST_CASE("audio/oscillator: MipmappedMorphingWavetableOscillator")
+{
+    using Wavetable  = grit::MipmappedWavetable<double, tableSize, numLevels>;
+    using Oscillator = grit::MipmappedMorphingWavetableOscillator<double, 2, tableSize, numLevels>;
+
+    auto const saw    = makeSawtooth<double>();
+    auto const square = [] {
+        auto table = etl::array<double, tableSize>{};
+        for (auto i = etl::size_t(0); i < tableSize; ++i) {
+            table[i] = i < tableSize / 2 ? 1.0 : -1.0;
+        }
+        return table;
+    }();
+
+    auto frames = etl::array<Wavetable, 2>{};
+    frames[0].setWaveform(saw);
+    frames[1].setWaveform(square);
+
+    SECTION("the ends match the single frame oscillator")
+    {
+        for (auto const [morph, frame] : {etl::pair{0.0, etl::size_t(0)}, etl::pair{1.0, etl::size_t(1)}}) {
+            auto morphing = Oscillator{frames};
+            auto single   = grit::MipmappedWavetableOscillator<double, tableSize, numLevels>{frames[frame]};
+            morphing.setShapeMorph(morph);
+            morphing.setSampleRate(sampleRate);
+            single.setSampleRate(sampleRate);
+            morphing.setFrequency(1'500.0);
+            single.setFrequency(1'500.0);
+
+            for (auto i = 0; i < 500; ++i) {
+                REQUIRE(morphing() == Catch::Approx(single()).margin(1e-12));
+            }
+        }
+    }
+
+    SECTION("the morph is band-limited")
+    {
+        auto naiveFrames = etl::array<double, 2 * tableSize>{};
+        etl::copy(saw.begin(), saw.end(), naiveFrames.begin());
+        etl::copy(square.begin(), square.end(), naiveFrames.begin() + tableSize);
+
+        for (auto const frequency : {1'234.5, 2'637.3, 5'111.1}) {
+            auto mipmapped = Oscillator{frames};
+            auto naive     = grit::MorphingWavetableOscillator<double, 2, tableSize>{
+                etl::mdspan{naiveFrames.data(), etl::extents<etl::size_t, 2, tableSize>{}}
+            };
+            mipmapped.setShapeMorph(0.3);
+            naive.setShapeMorph(0.3);
+
+            auto const bandLimited = aliasing(mipmapped, frequency);
+            auto const reference   = aliasing(naive, frequency);
+
+            CAPTURE(frequency, bandLimited, reference);
+            REQUIRE(bandLimited < reference * 0.01);
+        }
+    }
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <grit/math/hermite_interpolation.hpp>
+#include <grit/math/linear_interpolation.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/cmath.hpp>
+#include <etl/concepts.hpp>
+#include <etl/mdspan.hpp>
+
+namespace grit {
+
+/// \brief Wavetable oscillator morphing between the frames of a 2D wavetable.
+///
+/// \details The wavetable has one single cycle waveform per row. The morph
+/// position is turned into a frame pair & crossfade in setShapeMorph(), so
+/// call it once per block. Per sample the four hermite taps are crossfaded
+/// between the two frames before interpolating, one hermite evaluation
+/// instead of two.
+///
+/// \ingroup grit-audio-oscillator
+template<
+    etl::floating_point Float,
+    etl::size_t Frames    = etl::dynamic_extent,
+    etl::size_t TableSize = etl::dynamic_extent>
+struct MorphingWavetableOscillator
+{
+    using Wavetable = etl::mdspan<Float const, etl::extents<etl::size_t, Frames, TableSize>>;
+
+    explicit MorphingWavetableOscillator(Wavetable wavetable);
+
+    auto setWavetable(Wavetable wavetable) -> void;
+
+    /// 0 is the first frame, 1 the last.
+    auto setShapeMorph(Float morph) -> void;
+
+    auto setPhase(Float phase) -> void;
+    auto setFrequency(Float frequency) -> void;
+    auto setSampleRate(Float sampleRate) -> void;
+
+    auto addPhaseOffset(Float offset) -> void;
+
+    [[nodiscard]] auto operator()() -> Float;
+
+private:
+    Float _sampleRate{0};
+    Float _phase{0};
+    Float _phaseIncrement{0};
+    Float _morph{0};
+    Float _fade{0};
+    etl::size_t _frame{0};
+    etl::size_t _nextFrame{0};
+    Wavetable _wavetable;
+};
+
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize>
+MorphingWavetableOscillator<Float, Frames, TableSize>::MorphingWavetableOscillator(Wavetable wavetable)
+    : _wavetable{wavetable}
+{
+    setShapeMorph(Float(0));
+}
+
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize>
+auto MorphingWavetableOscillator<Float, Frames, TableSize>::setWavetable(Wavetable wavetable) -> void
+{
+    _wavetable = wavetable;
+    setShapeMorph(_morph);
+}
+
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize>
+auto MorphingWavetableOscillator<Float, Frames, TableSize>::setShapeMorph(Float morph) -> void
+{
+    _morph = etl::clamp(morph, Float(0), Float(1));
+
+    auto const lastFrame = _wavetable.extent(0) == 0 ? etl::size_t(0) : _wavetable.extent(0) - 1;
+    auto const position  = _morph * static_cast<Float>(lastFrame);
+
+    _frame     = etl::min(static_cast<etl::size_t>(position), lastFrame);
+    _nextFrame = etl::min(_frame + 1, lastFrame);
+    _fade      = position - static_cast<Float>(_frame);
+}
+
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize>
+auto MorphingWavetableOscillator<Float, Frames, TableSize>::setPhase(Float phase) -> void
+{
+    _phase = phase;
+}
+
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize>
+auto MorphingWavetableOscillator<Float, Frames, TableSize>::setFrequency(Float frequency) -> void
+{
+    _phaseIncrement = 1.0F / (_sampleRate / frequency);
+}
+
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize>
+auto MorphingWavetableOscillator<Float, Frames, TableSize>::setSampleRate(Float sampleRate) -> void
+{
+    _sampleRate = sampleRate;
+}
+
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize>
+auto MorphingWavetableOscillator<Float, Frames, TableSize>::addPhaseOffset(Float offset) -> void
+{
+    _phase += offset;
+    _phase -= etl::floor(_phase);
+}
+
+template<etl::floating_point Float, etl::size_t Frames, etl::size_t TableSize>
+auto MorphingWavetableOscillator<Float, Frames, TableSize>::operator()() -> Float
+{
+    if (_wavetable.empty()) {
+        return Float(0);
+    }
+
+    auto const size         = _wavetable.extent(1);
+    auto const scaledPhase  = _phase * static_cast<Float>(size);
+    auto const sampleIndex  = static_cast<etl::size_t>(scaledPhase);
+    auto const sampleOffset = scaledPhase - static_cast<Float>(sampleIndex);
+    addPhaseOffset(_phaseIncrement);
+
+    auto const tap = [this, size, pos = sampleIndex + size](etl::size_t offset) {
+        auto const index = (pos + offset - 1) % size;
+        return linearInterpolation(_wavetable(_frame, index), _wavetable(_nextFrame, index), _fade);
+    };
+
+    return hermiteInterpolation(tap(0), tap(1), tap(2), tap(3), sampleOffset);
+}
+
+}  // namespace grit
@@ -0,0 +1,90 @@
+#include "morphing_wavetable_oscillator.hpp"
+#include "wavetable_oscillator.hpp"
+
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/mdspan.hpp>
+#include <etl/numbers.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+namespace {
+
+inline constexpr auto tableSize = etl::size_t(512);
+inline constexpr auto numFrames = etl::size_t(3);
+
+template<typename Float>
+[[nodiscard]] auto makeFrames() -> etl::array<Float, numFrames * tableSize>
+{
+    auto const odd = [](auto k) { return k % 2 == 1 ? 1.0 / double(k) : 0.0; };
+
+    auto const sine   = grit::makeHarmonicWavetable<Float, tableSize, 1>([](auto) { return 1.0; });
+    auto const square = grit::makeHarmonicWavetable<Float, tableSize, 15>(odd);
+    auto const saw    = grit::makeHarmonicWavetable<Float, tableSize, 15>([](auto k) { return 1.0 / double(k); });
+
+    auto frames = etl::array<Float, numFrames * tableSize>{};
+    etl::copy(sine.begin(), sine.end(), frames.begin());
+    etl::copy(square.begin(), square.end(), frames.begin() + tableSize);
+    etl::copy(saw.begin(), saw.end(), frames.begin() + tableSize * 2);
+    return frames;
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("audio/oscillator: makeHarmonicWavetable", "", float, double)
+{
+    using Float = TestType;
+
+    auto const table = grit::makeHarmonicWavetable<Float, tableSize, 3>([](auto k) { return k == 3 ? 0.5 : 0.0; });
+    for (auto n = etl::size_t(0); n < tableSize; ++n) {
+        auto const phase = 2.0 * etl::numbers::pi * double(n) / double(tableSize);
+        REQUIRE(double(table[n]) == Catch::Approx(0.5 * etl::sin(3.0 * phase)).margin(1e-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/oscillator: MorphingWavetableOscillator", "", float, double)
+{
+    using Float = TestType;
+
+    auto const frames = makeFrames<Float>();
+    auto const table  = etl::mdspan{frames.data(), etl::extents<etl::size_t, numFrames, tableSize>{}};
+
+    auto frame = [&](etl::size_t index) {
+        auto single = grit::WavetableOscillator<Float, tableSize>{
+            etl::mdspan{frames.data() + index * tableSize, etl::extents<etl::size_t, tableSize>{}},
+        };
+        single.setSampleRate(Float(48'000));
+        single.setFrequency(Float(441));
+        return single;
+    };
+
+    auto const morph = GENERATE(0.0, 0.25, 0.5, 0.6, 1.0);
+
+    auto osc = grit::MorphingWavetableOscillator<Float, numFrames, tableSize>{table};
+    osc.setSampleRate(Float(48'000));
+    osc.setFrequency(Float(441));
+    osc.setShapeMorph(Float(morph));
+
+    // The morph spans the frames linearly.
+    auto const position = morph * double(numFrames - 1);
+    auto const index    = etl::min(static_cast<etl::size_t>(position), numFrames - 2);
+    auto const fade     = Float(position - double(index));
+
+    auto a = frame(index);
+    auto b = frame(index + 1);
+    for (auto i{0}; i < 1'000; ++i) {
+        auto const expected = a() * (Float(1) - fade) + b() * fade;
+        REQUIRE(osc() == Catch::Approx(expected).margin(1e-5));
+    }
+}
+
+TEST_CASE("audio/oscillator: MorphingWavetableOscillator with empty wavetable")
+{
+    auto osc = grit::MorphingWavetableOscillator<float>{{}};
+    osc.setSampleRate(48'000.0F);
+    osc.setFrequency(440.0F);
+    osc.setShapeMorph(0.5F);
+    REQUIRE(osc() == Catch::Approx(0.0F));
+}
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <grit/audio/oscillator/poly_blep.hpp>
+#include <grit/math/fast.hpp>
 #include <grit/math/remap.hpp>
 
 #include <etl/algorithm.hpp>
+#include <etl/cmath.hpp>
 #include <etl/concepts.hpp>
 #include <etl/cstdint.hpp>
-#include <etl/numbers.hpp>
 
 namespace grit {
 
@@ -15,8 +17,15 @@ enum struct OscillatorShape : etl::uint8_t
     Sine,
     Triangle,
     Square,
+    Sawtooth,
 };
 
+/// \brief Band-limited oscillator.
+///
+/// \details Triangle, square & sawtooth are corrected with polyBLAMP/polyBLEP
+/// residuals at their corners & edges. That removes most of the aliasing of
+/// the naive shapes without oversampling.
+///
 /// \ingroup grit-audio-oscillator
 template<etl::floating_point Float>
 struct Oscillator
@@ -24,6 +33,7 @@ struct Oscillator
     Oscillator() = default;
 
     auto setShape(OscillatorShape shape) -> void;
+    auto setPulseWidth(Float width) -> void;
     auto setPhase(Float phase) -> void;
     auto setFrequency(Float frequency) -> void;
     auto setSampleRate(Float sampleRate) -> void;
@@ -32,11 +42,13 @@ struct Oscillator
 
     [[nodiscard]] auto operator()() -> Float;
 
-private:
+    /// Shapes at a phase in [0, 1), shared with Batch<Oscillator>.
     [[nodiscard]] static auto sine(Float phase) -> Float;
-    [[nodiscard]] static auto triangle(Float phase) -> Float;
-    [[nodiscard]] static auto pulse(Float phase, Float width) -> Float;
+    [[nodiscard]] static auto triangle(Float phase, Float increment) -> Float;
+    [[nodiscard]] static auto pulse(Float phase, Float width, Float increment) -> Float;
+    [[nodiscard]] static auto sawtooth(Float phase, Float increment) -> Float;
 
+private:
     OscillatorShape _shape{OscillatorShape::Sine};
     Float _sampleRate{0};
     Float _phase{0};
@@ -50,6 +62,12 @@ auto Oscillator<Float>::setShape(OscillatorShape shape) -> void
     _shape = shape;
 }
 
+template<etl::floating_point Float>
+auto Oscillator<Float>::setPulseWidth(Float width) -> void
+{
+    _pulseWidth = etl::clamp(width, Float{0}, Float{1});
+}
+
 template<etl::floating_point Float>
 auto Oscillator<Float>::setPhase(Float phase) -> void
 {
@@ -85,11 +103,15 @@ auto Oscillator<Float>::operator()() -> Float
             break;
         }
         case OscillatorShape::Triangle: {
-            output = triangle(_phase);
+            output = triangle(_phase, _phaseIncrement);
             break;
         }
         case OscillatorShape::Square: {
-            output = pulse(_phase, _pulseWidth);
+            output = pulse(_phase, _pulseWidth, _phaseIncrement);
+            break;
+        }
+        case OscillatorShape::Sawtooth: {
+            output = sawtooth(_phase, _phaseIncrement);
             break;
         }
         default: {
@@ -104,25 +126,34 @@ auto Oscillator<Float>::operator()() -> Float
 template<etl::floating_point Float>
 auto Oscillator<Float>::sine(Float phase) -> Float
 {
-    static constexpr auto twoPi = static_cast<Float>(etl::numbers::pi) * Float{2};
-    return etl::sin(phase * twoPi);
+    return fast::sin2pi<fast::Accuracy::Fine>(phase);
 }
 
 template<etl::floating_point Float>
-auto Oscillator<Float>::triangle(Float phase) -> Float
+auto Oscillator<Float>::triangle(Float phase, Float increment) -> Float
 {
-    auto const x = phase <= Float{0.5} ? phase : Float{1} - phase;
-    return (x - Float{0.25}) * Float{4};
+    auto const x     = phase <= Float{0.5} ? phase : Float{1} - phase;
+    auto const naive = (x - Float{0.25}) * Float{4};
+
+    // The slope flips between +4 and -4 per cycle at the corners.
+    auto const peak = phase < Float{0.5} ? phase + Float{0.5} : phase - Float{0.5};
+    return naive + Float{8} * increment * (polyBlamp(phase, increment) - polyBlamp(peak, increment));
 }
 
 template<etl::floating_point Float>
-auto Oscillator<Float>::pulse(Float phase, Float width) -> Float
+auto Oscillator<Float>::pulse(Float phase, Float width, Float increment) -> Float
 {
-    auto const w = etl::clamp(width, Float{0}, Float{1});
-    if (phase < w) {
-        return Float{-1};
-    }
-    return Float{1};
+    auto const naive = phase < width ? Float{-1} : Float{1};
+
+    // Falling edge at phase 0, rising edge at the pulse width.
+    auto const rise = phase < width ? phase - width + Float{1} : phase - width;
+    return naive - polyBlep(phase, increment) + polyBlep(rise, increment);
+}
+
+template<etl::floating_point Float>
+auto Oscillator<Float>::sawtooth(Float phase, Float increment) -> Float
+{
+    return phase * Float{2} - Float{1} - polyBlep(phase, increment);
 }
 
 }  // namespace grit
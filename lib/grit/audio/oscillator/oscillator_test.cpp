@@ -0,0 +1,129 @@
+#include "oscillator.hpp"
+
+#include <grit/fft/real_plan.hpp>
+
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/complex.hpp>
+#include <etl/mdspan.hpp>
+#include <etl/numbers.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+namespace {
+
+inline constexpr auto sampleRate = 48'000.0;
+inline constexpr auto fftSize    = etl::size_t(4096);
+
+template<typename Func>
+[[nodiscard]] auto aliasingEnergy(double frequency, Func naive) -> double
+{
+    auto samples = etl::array<double, fftSize>{};
+    auto bins    = etl::array<etl::complex<double>, fftSize / 2 + 1>{};
+
+    for (auto i = etl::size_t(0); i < fftSize; ++i) {
+        auto const window = 0.5 - 0.5 * etl::cos(2.0 * etl::numbers::pi * double(i) / double(fftSize));
+        samples[i]        = naive() * window;
+    }
+
+    auto plan = grit::fft::RealPlan<double, fftSize>{};
+    plan(etl::mdspan{samples.data(), etl::extents{fftSize}}, etl::mdspan{bins.data(), etl::extents{bins.size()}});
+
+    // Everything not close to a harmonic below nyquist is aliasing.
+    auto const binWidth = sampleRate / double(fftSize);
+    auto energy         = 0.0;
+    for (auto k = etl::size_t(0); k < bins.size(); ++k) {
+        auto const f        = double(k) * binWidth;
+        auto const harmonic = etl::round(f / frequency) * frequency;
+        if (etl::abs(f - harmonic) > binWidth * 4.0) {
+            energy += etl::norm(bins[k]);
+        }
+    }
+    return energy;
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("audio/oscillator: Oscillator", "", float, double)
+{
+    using Float = TestType;
+
+    auto const shape = GENERATE(
+        grit::OscillatorShape::Sine,
+        grit::OscillatorShape::Triangle,
+        grit::OscillatorShape::Square,
+        grit::OscillatorShape::Sawtooth
+    );
+
+    auto osc = grit::Oscillator<Float>{};
+    osc.setShape(shape);
+    osc.setSampleRate(Float(sampleRate));
+    osc.setFrequency(Float(440));
+
+    auto sum = Float(0);
+    for (auto i{0}; i < 48'000; ++i) {
+        auto const out = osc();
+        REQUIRE(out >= Float(-1.1));
+        REQUIRE(out <= Float(1.1));
+        sum += out;
+    }
+    REQUIRE(sum / Float(48'000) == Catch::Approx(0).margin(1e-2));
+}
+
+TEMPLATE_TEST_CASE("audio/oscillator: Oscillator::setPulseWidth", "", float, double)
+{
+    using Float = TestType;
+
+    auto const width = GENERATE(Float(0), Float(0.1), Float(0.25), Float(0.5), Float(0.8), Float(1));
+
+    auto osc = grit::Oscillator<Float>{};
+    osc.setShape(grit::OscillatorShape::Square);
+    osc.setPulseWidth(width);
+    osc.setSampleRate(Float(sampleRate));
+    osc.setFrequency(Float(100));
+
+    auto sum = Float(0);
+    for (auto i{0}; i < 48'000; ++i) {
+        sum += osc();
+    }
+    REQUIRE(sum / Float(48'000) == Catch::Approx(Float(1) - width * Float(2)).margin(1e-2));
+}
+
+TEST_CASE("audio/oscillator: Oscillator is band-limited")
+{
+    // Non-integer period, so the folded harmonics land between the harmonics.
+    auto const frequency = 2'637.3;
+    auto const increment = frequency / sampleRate;
+
+    auto const shape = GENERATE(
+        grit::OscillatorShape::Triangle,
+        grit::OscillatorShape::Square,
+        grit::OscillatorShape::Sawtooth
+    );
+
+    auto osc = grit::Oscillator<double>{};
+    osc.setShape(shape);
+    osc.setSampleRate(sampleRate);
+    osc.setFrequency(frequency);
+
+    auto phase = 0.0;
+    auto naive = [&] {
+        auto const p = phase;
+        phase += increment;
+        phase -= etl::floor(phase);
+
+        switch (shape) {
+            case grit::OscillatorShape::Triangle: return (etl::min(p, 1.0 - p) - 0.25) * 4.0;
+            case grit::OscillatorShape::Square: return p < 0.5 ? -1.0 : 1.0;
+            default: return p * 2.0 - 1.0;
+        }
+    };
+
+    auto const bandLimited = aliasingEnergy(frequency, [&] { return osc(); });
+    auto const reference   = aliasingEnergy(frequency, naive);
+
+    CAPTURE(shape, bandLimited, reference);
+    REQUIRE(bandLimited < reference * 0.1);
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <etl/concepts.hpp>
+
+namespace grit {
+
+/// \brief Two sample polynomial band-limited step residual.
+///
+/// \details Correction for a downward step of height 2 at phase 0, subtract it
+/// from the naive waveform. Non-zero only within one phase increment on either
+/// side of the discontinuity.
+///
+/// \pre 0 <= phase < 1, 0 < increment < 0.5
+/// \ingroup grit-audio-oscillator
+template<etl::floating_point Float>
+[[nodiscard]] constexpr auto polyBlep(Float phase, Float increment) -> Float
+{
+    if (phase < increment) {
+        auto const x = phase / increment;
+        return x + x - x * x - Float(1);
+    }
+    if (phase > Float(1) - increment) {
+        auto const x = (phase - Float(1)) / increment;
+        return x * x + x + x + Float(1);
+    }
+    return Float(0);
+}
+
+/// \brief Two sample polynomial band-limited ramp residual.
+///
+/// \details Integral of the polyBlep kernel. Correction for a change in slope
+/// of 1 per sample at phase 0, scale it by the actual change in slope.
+///
+/// \pre 0 <= phase < 1, 0 < increment < 0.5
+/// \ingroup grit-audio-oscillator
+template<etl::floating_point Float>
+[[nodiscard]] constexpr auto polyBlamp(Float phase, Float increment) -> Float
+{
+    if (phase < increment) {
+        auto const x = Float(1) - phase / increment;
+        return x * x * x / Float(6);
+    }
+    if (phase > Float(1) - increment) {
+        auto const x = Float(1) + (phase - Float(1)) / increment;
+        return x * x * x / Float(6);
+    }
+    return Float(0);
+}
+
+}  // namespace grit
@@ -16,6 +16,7 @@ struct VariableShapeOscillator
 
     auto setShapes(OscillatorShape a, OscillatorShape b) -> void;
     auto setShapeMorph(Float morph) -> void;
+    auto setPulseWidth(Float width) -> void;
 
     auto setPhase(Float phase) -> void;
     auto setFrequency(Float frequency) -> void;
@@ -47,6 +48,13 @@ auto VariableShapeOscillator<Float>::setShapeMorph(Float morph) -> void
     });
 }
 
+template<etl::floating_point Float>
+auto VariableShapeOscillator<Float>::setPulseWidth(Float width) -> void
+{
+    _oscA.setPulseWidth(width);
+    _oscB.setPulseWidth(width);
+}
+
 template<etl::floating_point Float>
 auto VariableShapeOscillator<Float>::setPhase(Float phase) -> void
 {
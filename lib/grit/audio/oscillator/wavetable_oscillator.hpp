@@ -11,8 +11,16 @@
 
 namespace grit {
 
+/// \brief Single wavetable oscillator.
+///
+/// \details With one of the guarded interpolations the wavetable has to be
+/// made by makeGuardedTable(), the reads then don't wrap at all.
+///
 /// \ingroup grit-audio-oscillator
-template<etl::floating_point Float, etl::size_t TableSize = etl::dynamic_extent>
+template<
+    etl::floating_point Float,
+    etl::size_t TableSize  = etl::dynamic_extent,
+    typename Interpolation = BufferInterpolation::Hermite>
 struct WavetableOscillator
 {
     explicit WavetableOscillator(etl::mdspan<Float const, etl::extents<etl::size_t, TableSize>> wavetable);
@@ -30,6 +38,7 @@ private:
     Float _phase{0};
     Float _phaseIncrement{0};
     etl::mdspan<Float const, etl::extents<etl::size_t, TableSize>> _wavetable;
+    TETL_NO_UNIQUE_ADDRESS Interpolation _interpolator{};
 };
 
 /// \relates WavetableOscillator
@@ -37,51 +46,59 @@ private:
 template<typename Float, etl::size_t Size>
 [[nodiscard]] constexpr auto makeSineWavetable() -> etl::array<Float, Size>;
 
-template<etl::floating_point Float, etl::size_t TableSize>
-WavetableOscillator<Float, TableSize>::WavetableOscillator(
+/// \brief Single cycle with harmonics 1 to Harmonics, harmonic k scaled by amplitude(k).
+/// \relates WavetableOscillator
+/// \ingroup grit-audio-oscillator
+template<typename Float, etl::size_t Size, etl::size_t Harmonics, typename Amplitude>
+    requires(Harmonics <= Size / 2)
+[[nodiscard]] constexpr auto makeHarmonicWavetable(Amplitude amplitude) -> etl::array<Float, Size>;
+
+template<etl::floating_point Float, etl::size_t TableSize, typename Interpolation>
+WavetableOscillator<Float, TableSize, Interpolation>::WavetableOscillator(
     etl::mdspan<Float const, etl::extents<etl::size_t, TableSize>> wavetable
 )
     : _wavetable{wavetable}
 {}
 
-template<etl::floating_point Float, etl::size_t TableSize>
-auto WavetableOscillator<Float, TableSize>::setPhase(Float phase) -> void
+template<etl::floating_point Float, etl::size_t TableSize, typename Interpolation>
+auto WavetableOscillator<Float, TableSize, Interpolation>::setPhase(Float phase) -> void
 {
     _phase = phase;
 }
 
-template<etl::floating_point Float, etl::size_t TableSize>
-auto WavetableOscillator<Float, TableSize>::setFrequency(Float frequency) -> void
+template<etl::floating_point Float, etl::size_t TableSize, typename Interpolation>
+auto WavetableOscillator<Float, TableSize, Interpolation>::setFrequency(Float frequency) -> void
 {
     _phaseIncrement = 1.0F / (_sampleRate / frequency);
 }
 
-template<etl::floating_point Float, etl::size_t TableSize>
-auto WavetableOscillator<Float, TableSize>::setSampleRate(Float sampleRate) -> void
+template<etl::floating_point Float, etl::size_t TableSize, typename Interpolation>
+auto WavetableOscillator<Float, TableSize, Interpolation>::setSampleRate(Float sampleRate) -> void
 {
     _sampleRate = sampleRate;
 }
 
-template<etl::floating_point Float, etl::size_t TableSize>
-auto WavetableOscillator<Float, TableSize>::addPhaseOffset(Float offset) -> void
+template<etl::floating_point Float, etl::size_t TableSize, typename Interpolation>
+auto WavetableOscillator<Float, TableSize, Interpolation>::addPhaseOffset(Float offset) -> void
 {
     _phase += offset;
     _phase -= etl::floor(_phase);
 }
 
-template<etl::floating_point Float, etl::size_t TableSize>
-auto WavetableOscillator<Float, TableSize>::operator()() -> Float
+template<etl::floating_point Float, etl::size_t TableSize, typename Interpolation>
+auto WavetableOscillator<Float, TableSize, Interpolation>::operator()() -> Float
 {
     if (_wavetable.empty()) {
         return Float(0);
     }
 
-    auto const scaledPhase  = _phase * static_cast<Float>(_wavetable.size());
+    auto const size         = _wavetable.size() - bufferGuardPoints<Interpolation>;
+    auto const scaledPhase  = _phase * static_cast<Float>(size);
     auto const sampleIndex  = static_cast<etl::size_t>(scaledPhase);
     auto const sampleOffset = scaledPhase - static_cast<Float>(sampleIndex);
     addPhaseOffset(_phaseIncrement);
 
-    return BufferInterpolation::Hermite{}(_wavetable, sampleIndex, sampleOffset);
+    return _interpolator(_wavetable, sampleIndex, sampleOffset);
 }
 
 template<typename Float, etl::size_t Size>
@@ -100,4 +117,29 @@ constexpr auto makeSineWavetable() -> etl::array<Float, Size>
     etl::generate(begin(table), end(table), gen);
     return table;
 }
+
+template<typename Float, etl::size_t Size, etl::size_t Harmonics, typename Amplitude>
+    requires(Harmonics <= Size / 2)
+constexpr auto makeHarmonicWavetable(Amplitude amplitude) -> etl::array<Float, Size>
+{
+    // One period of sine, harmonic k at sample n is sine[k*n % Size].
+    auto const delta = static_cast<Float>(etl::numbers::pi * 2.0) / static_cast<Float>(Size);
+
+    auto sine = etl::array<Float, Size>{};
+    for (auto n = etl::size_t(0); n < Size; ++n) {
+        sine[n] = etl::sin(delta * static_cast<Float>(n));
+    }
+
+    auto table = etl::array<Float, Size>{};
+    for (auto k = etl::size_t(1); k <= Harmonics; ++k) {
+        auto const gain = static_cast<Float>(amplitude(k));
+        if (gain == Float(0)) {
+            continue;
+        }
+        for (auto n = etl::size_t(0); n < Size; ++n) {
+            table[n] += gain * sine[k * n % Size];
+        }
+    }
+    return table;
+}
 }  // namespace grit
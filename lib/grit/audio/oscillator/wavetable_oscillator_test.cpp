@@ -0,0 +1,34 @@
+#include "wavetable_oscillator.hpp"
+
+#include <etl/mdspan.hpp>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+TEMPLATE_TEST_CASE("audio/oscillator: WavetableOscillator", "", float, double)
+{
+    using Float = TestType;
+
+    static constexpr auto sine    = grit::makeHarmonicWavetable<Float, 256, 4>([](auto k) { return 1.0 / double(k); });
+    static constexpr auto guarded = grit::makeGuardedTable(sine);
+
+    using Guarded = grit::BufferInterpolation::GuardedHermite;
+
+    auto osc = grit::WavetableOscillator<Float, sine.size()>{
+        etl::mdspan<Float const, etl::extents<etl::size_t, sine.size()>>{sine.data()},
+    };
+    auto guardedOsc = grit::WavetableOscillator<Float, guarded.size(), Guarded>{
+        etl::mdspan<Float const, etl::extents<etl::size_t, guarded.size()>>{guarded.data()},
+    };
+
+    osc.setSampleRate(Float(48'000));
+    osc.setFrequency(Float(1'234));
+    guardedOsc.setSampleRate(Float(48'000));
+    guardedOsc.setFrequency(Float(1'234));
+
+    for (auto i{0}; i < 10'000; ++i) {
+        auto const fm = Float(i % 7) * Float(0.001);
+        osc.addPhaseOffset(fm);
+        guardedOsc.addPhaseOffset(fm);
+        REQUIRE(guardedOsc() == osc());
+    }
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+/// \defgroup grit-audio-oversampling Oversampling
+/// \ingroup grit-audio
+
+#include <grit/audio/oversampling/halfband_filter.hpp>
+#include <grit/audio/oversampling/oversampled.hpp>
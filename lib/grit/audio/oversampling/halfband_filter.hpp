@@ -0,0 +1,189 @@
+#pragma once
+
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/concepts.hpp>
+#include <etl/numbers.hpp>
+#include <etl/span.hpp>
+
+namespace grit {
+
+/// \brief First half of the symmetric branch of a Kaiser windowed halfband FIR.
+///
+/// \details A halfband filter of length 2 * Taps - 1 has every second
+/// coefficient zero, except the center one which is 0.5. In the polyphase
+/// form one branch is a plain delay and the other a symmetric FIR with Taps
+/// coefficients. Only the first half of those is returned, normalized so the
+/// filter has unity gain at DC.
+///
+/// \ingroup grit-audio-oversampling
+template<etl::floating_point Float, etl::size_t Taps>
+[[nodiscard]] constexpr auto makeHalfbandCoefficients(double beta = 7.0) -> etl::array<Float, Taps / 2>
+{
+    static_assert(Taps >= 2 and Taps % 2 == 0);
+
+    // Zeroth order modified bessel function of the first kind
+    auto const bessel = [](double x) {
+        auto sum  = 1.0;
+        auto term = 1.0;
+        for (auto k = 1; k < 32; ++k) {
+            term *= (x / (2.0 * k)) * (x / (2.0 * k));
+            sum += term;
+        }
+        return sum;
+    };
+
+    auto const length = 2.0 * Taps - 1.0;
+    auto const center = (length - 1.0) / 2.0;
+
+    auto coefficients = etl::array<double, Taps / 2>{};
+    auto sum          = 0.0;
+    for (auto k = etl::size_t(0); k < Taps / 2; ++k) {
+        auto const n      = 2.0 * static_cast<double>(k);
+        auto const x      = (n - center) / 2.0;
+        auto const sinc   = etl::sin(etl::numbers::pi * x) / (etl::numbers::pi * x);
+        auto const ratio  = (n - center) / center;
+        auto const window = bessel(beta * etl::sqrt(1.0 - ratio * ratio)) / bessel(beta);
+        coefficients[k]   = 0.5 * sinc * window;
+        sum += coefficients[k] * 2.0;
+    }
+
+    auto result = etl::array<Float, Taps / 2>{};
+    for (auto k = etl::size_t(0); k < Taps / 2; ++k) {
+        result[k] = static_cast<Float>(coefficients[k] * 0.5 / sum);
+    }
+    return result;
+}
+
+/// \brief Doubles the sample rate with a polyphase halfband filter.
+///
+/// \details Per input sample the even output is the symmetric branch, Taps / 2
+/// multiplies after folding, and the odd output is the delayed input.
+///
+/// \ingroup grit-audio-oversampling
+template<etl::floating_point Float, etl::size_t Taps = 16>
+struct HalfbandUpsampler
+{
+    using SampleType = Float;
+
+    HalfbandUpsampler() = default;
+
+    /// Group delay in samples at the output rate.
+    [[nodiscard]] static constexpr auto latency() -> etl::size_t { return Taps - 1; }
+
+    auto reset() -> void;
+
+    [[nodiscard]] auto operator()(Float x) -> etl::array<Float, 2>;
+
+    /// \pre output.size() == input.size() * 2, input & output may not alias
+    auto process(etl::span<Float const> input, etl::span<Float> output) -> void;
+
+private:
+    static constexpr auto coefficients = makeHalfbandCoefficients<Float, Taps>();
+
+    etl::array<Float, Taps * 2> _history{};
+    etl::size_t _pos{0};
+};
+
+template<etl::floating_point Float, etl::size_t Taps>
+auto HalfbandUpsampler<Float, Taps>::reset() -> void
+{
+    _history.fill(Float(0));
+    _pos = 0;
+}
+
+template<etl::floating_point Float, etl::size_t Taps>
+auto HalfbandUpsampler<Float, Taps>::operator()(Float x) -> etl::array<Float, 2>
+{
+    // Written twice, the last Taps inputs are always contiguous, newest first.
+    _pos                  = _pos == 0 ? Taps - 1 : _pos - 1;
+    _history[_pos]        = x;
+    _history[_pos + Taps] = x;
+
+    auto const* const window = _history.data() + _pos;
+
+    auto even = Float(0);
+    for (auto k = etl::size_t(0); k < Taps / 2; ++k) {
+        even += coefficients[k] * (window[k] + window[Taps - 1 - k]);
+    }
+
+    return {even * Float(2), window[Taps / 2 - 1]};
+}
+
+template<etl::floating_point Float, etl::size_t Taps>
+auto HalfbandUpsampler<Float, Taps>::process(etl::span<Float const> input, etl::span<Float> output) -> void
+{
+    for (auto i = etl::size_t(0); i < input.size(); ++i) {
+        auto const [even, odd] = (*this)(input[i]);
+        output[i * 2]          = even;
+        output[i * 2 + 1]      = odd;
+    }
+}
+
+/// \brief Halves the sample rate with a polyphase halfband filter.
+///
+/// \details Even input samples go through the symmetric branch, Taps / 2
+/// multiplies after folding, odd input samples only through a delay.
+///
+/// \ingroup grit-audio-oversampling
+template<etl::floating_point Float, etl::size_t Taps = 16>
+struct HalfbandDownsampler
+{
+    using SampleType = Float;
+
+    HalfbandDownsampler() = default;
+
+    /// Group delay in samples at the input rate.
+    [[nodiscard]] static constexpr auto latency() -> etl::size_t { return Taps - 1; }
+
+    auto reset() -> void;
+
+    [[nodiscard]] auto operator()(Float even, Float odd) -> Float;
+
+    /// \pre input.size() == output.size() * 2, input & output may alias
+    auto process(etl::span<Float const> input, etl::span<Float> output) -> void;
+
+private:
+    static constexpr auto coefficients = makeHalfbandCoefficients<Float, Taps>();
+
+    etl::array<Float, Taps * 2> _even{};
+    etl::array<Float, Taps * 2> _odd{};
+    etl::size_t _pos{0};
+};
+
+template<etl::floating_point Float, etl::size_t Taps>
+auto HalfbandDownsampler<Float, Taps>::reset() -> void
+{
+    _even.fill(Float(0));
+    _odd.fill(Float(0));
+    _pos = 0;
+}
+
+template<etl::floating_point Float, etl::size_t Taps>
+auto HalfbandDownsampler<Float, Taps>::operator()(Float even, Float odd) -> Float
+{
+    _pos               = _pos == 0 ? Taps - 1 : _pos - 1;
+    _even[_pos]        = even;
+    _even[_pos + Taps] = even;
+    _odd[_pos]         = odd;
+    _odd[_pos + Taps]  = odd;
+
+    auto const* const window = _even.data() + _pos;
+
+    auto out = Float(0);
+    for (auto k = etl::size_t(0); k < Taps / 2; ++k) {
+        out += coefficients[k] * (window[k] + window[Taps - 1 - k]);
+    }
+
+    return out + _odd[_pos + Taps / 2] * Float(0.5);
+}
+
+template<etl::floating_point Float, etl::size_t Taps>
+auto HalfbandDownsampler<Float, Taps>::process(etl::span<Float const> input, etl::span<Float> output) -> void
+{
+    for (auto i = etl::size_t(0); i < output.size(); ++i) {
+        output[i] = (*this)(input[i * 2], input[i * 2 + 1]);
+    }
+}
+
+}  // namespace grit
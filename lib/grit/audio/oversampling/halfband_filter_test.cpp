@@ -0,0 +1,96 @@
+#include "halfband_filter.hpp"
+
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/numbers.hpp>
+#include <etl/numeric.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <vector>
+
+namespace {
+
+template<typename Float, etl::size_t Taps>
+[[nodiscard]] auto roundTrip(double frequency, etl::size_t size) -> std::vector<Float>
+{
+    auto up   = grit::HalfbandUpsampler<Float, Taps>{};
+    auto down = grit::HalfbandDownsampler<Float, Taps>{};
+
+    auto output = std::vector<Float>(size);
+    for (auto i = etl::size_t(0); i < size; ++i) {
+        auto const x           = Float(etl::sin(2.0 * etl::numbers::pi * frequency * double(i)));
+        auto const [even, odd] = up(x);
+        output[i]              = down(even, odd);
+    }
+    return output;
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("audio/oversampling: makeHalfbandCoefficients", "", float, double)
+{
+    using Float = TestType;
+
+    auto const coefficients = grit::makeHalfbandCoefficients<Float, 16>();
+    STATIC_REQUIRE(coefficients.size() == 8);
+
+    // Both halves of the symmetric branch sum to 0.5, the other 0.5 is the center tap.
+    auto const sum = etl::accumulate(coefficients.begin(), coefficients.end(), Float(0));
+    REQUIRE(sum * Float(2) == Catch::Approx(0.5));
+
+    // Alternating signs, growing towards the center.
+    for (auto k = etl::size_t(1); k < coefficients.size(); ++k) {
+        REQUIRE(etl::abs(coefficients[k]) > etl::abs(coefficients[k - 1]));
+        REQUIRE(coefficients[k] * coefficients[k - 1] < Float(0));
+    }
+    REQUIRE(coefficients.back() > Float(0));
+}
+
+TEMPLATE_TEST_CASE("audio/oversampling: HalfbandUpsampler & HalfbandDownsampler", "", float, double)
+{
+    using Float = TestType;
+
+    STATIC_REQUIRE(grit::HalfbandUpsampler<Float, 16>::latency() == 15);
+    STATIC_REQUIRE(grit::HalfbandDownsampler<Float, 16>::latency() == 15);
+
+    // Up & down is a delay of one latency at the base rate in the passband.
+    auto const frequency = 0.01;
+    auto const output    = roundTrip<Float, 16>(frequency, 512);
+    for (auto i = etl::size_t(64); i < output.size(); ++i) {
+        auto const expected = etl::sin(2.0 * etl::numbers::pi * frequency * double(i - 15));
+        REQUIRE(double(output[i]) == Catch::Approx(expected).margin(1e-3));
+    }
+
+    // The odd upsampled outputs are the delayed input.
+    auto up = grit::HalfbandUpsampler<Float, 16>{};
+    for (auto i = 0; i < 32; ++i) {
+        auto const [even, odd] = up(Float(i + 1));
+        REQUIRE(odd == Catch::Approx(i >= 7 ? i - 6 : 0));
+    }
+}
+
+TEST_CASE("audio/oversampling: HalfbandDownsampler stopband")
+{
+    // Between 0.3 & 0.5 of the input rate, everything that would alias below the base rate's nyquist.
+    for (auto const frequency : {0.3, 0.35, 0.4, 0.45, 0.49}) {
+        auto down = grit::HalfbandDownsampler<double, 16>{};
+
+        auto input = etl::array<double, 4096>{};
+        for (auto i = etl::size_t(0); i < input.size(); ++i) {
+            input[i] = etl::sin(2.0 * etl::numbers::pi * frequency * double(i));
+        }
+
+        auto output = etl::array<double, 2048>{};
+        down.process(input, output);
+
+        auto peak = 0.0;
+        for (auto i = etl::size_t(64); i < output.size(); ++i) {
+            peak = etl::max(peak, etl::abs(output[i]));
+        }
+
+        CAPTURE(frequency, peak);
+        REQUIRE(peak < (frequency < 0.32 ? 0.05 : 0.001));
+    }
+}
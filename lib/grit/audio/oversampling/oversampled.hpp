@@ -0,0 +1,166 @@
+#pragma once
+
+#include <grit/audio/oversampling/halfband_filter.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/bit.hpp>
+#include <etl/concepts.hpp>
+#include <etl/span.hpp>
+
+namespace grit {
+
+/// \brief Runs a per sample processor at Factor times the sample rate.
+///
+/// \details Upsamples through a cascade of halfband stages, runs the
+/// processor on the oversampled block & decimates back through the same
+/// cascade. All stages use the same filter length. Blocks are handled in
+/// chunks of chunkSize samples, so the scratch memory is fixed.
+///
+/// setSampleRate() and reset() are forwarded to the processor if it has them,
+/// the sample rate multiplied by Factor.
+///
+/// \ingroup grit-audio-oversampling
+template<typename Processor, etl::size_t Factor, etl::size_t Taps = 16>
+struct Oversampled
+{
+    static_assert(etl::has_single_bit(Factor) and Factor <= 8);
+
+    using SampleType = typename Processor::SampleType;
+
+    static constexpr auto chunkSize = etl::size_t(32);
+
+    Oversampled() = default;
+
+    explicit Oversampled(Processor processor);
+
+    [[nodiscard]] static constexpr auto factor() -> etl::size_t { return Factor; }
+
+    /// Group delay of the up & down sampling in samples at the base rate.
+    [[nodiscard]] static constexpr auto latency() -> SampleType;
+
+    [[nodiscard]] auto processor() -> Processor& { return _processor; }
+
+    [[nodiscard]] auto processor() const -> Processor const& { return _processor; }
+
+    auto setSampleRate(SampleType sampleRate) -> void;
+    auto reset() -> void;
+
+    [[nodiscard]] auto operator()(SampleType x) -> SampleType;
+
+    /// Processes a block of samples. Equivalent to calling operator() on every sample.
+    /// \pre input.size() == output.size(), input & output may alias
+    auto process(etl::span<SampleType const> input, etl::span<SampleType> output) -> void;
+
+private:
+    using Float = SampleType;
+
+    static constexpr auto stages = static_cast<etl::size_t>(etl::countr_zero(Factor));
+
+    auto processChunk(etl::span<Float const> input, etl::span<Float> output) -> void;
+
+    Processor _processor{};
+    etl::array<HalfbandUpsampler<Float, Taps>, stages> _up{};
+    etl::array<HalfbandDownsampler<Float, Taps>, stages> _down{};
+    etl::array<Float, chunkSize * Factor> _ping{};
+    etl::array<Float, chunkSize * Factor> _pong{};
+};
+
+template<typename Processor, etl::size_t Factor, etl::size_t Taps>
+Oversampled<Processor, Factor, Taps>::Oversampled(Processor processor) : _processor{processor}
+{}
+
+template<typename Processor, etl::size_t Factor, etl::size_t Taps>
+constexpr auto Oversampled<Processor, Factor, Taps>::latency() -> SampleType
+{
+    // Each stage delays by Taps - 1 samples at its own rate, once going up & once going down.
+    auto delay = Float(0);
+    for (auto stage = etl::size_t(0); stage < stages; ++stage) {
+        delay += Float(2) * static_cast<Float>(Taps - 1) / static_cast<Float>(etl::size_t(2) << stage);
+    }
+    return delay;
+}
+
+template<typename Processor, etl::size_t Factor, etl::size_t Taps>
+auto Oversampled<Processor, Factor, Taps>::setSampleRate(SampleType sampleRate) -> void
+{
+    if constexpr (requires { _processor.setSampleRate(sampleRate); }) {
+        _processor.setSampleRate(sampleRate * static_cast<Float>(Factor));
+    }
+    reset();
+}
+
+template<typename Processor, etl::size_t Factor, etl::size_t Taps>
+auto Oversampled<Processor, Factor, Taps>::reset() -> void
+{
+    if constexpr (requires { _processor.reset(); }) {
+        _processor.reset();
+    }
+    for (auto& up : _up) {
+        up.reset();
+    }
+    for (auto& down : _down) {
+        down.reset();
+    }
+}
+
+template<typename Processor, etl::size_t Factor, etl::size_t Taps>
+auto Oversampled<Processor, Factor, Taps>::operator()(SampleType x) -> SampleType
+{
+    auto y = Float(0);
+    processChunk(etl::span<Float const>{&x, 1}, etl::span<Float>{&y, 1});
+    return y;
+}
+
+template<typename Processor, etl::size_t Factor, etl::size_t Taps>
+auto Oversampled<Processor, Factor, Taps>::process(
+    etl::span<SampleType const> input,
+    etl::span<SampleType> output
+) -> void
+{
+    for (auto offset = etl::size_t(0); offset < input.size(); offset += chunkSize) {
+        auto const size = etl::min(chunkSize, input.size() - offset);
+        processChunk(input.subspan(offset, size), output.subspan(offset, size));
+    }
+}
+
+template<typename Processor, etl::size_t Factor, etl::size_t Taps>
+auto Oversampled<Processor, Factor, Taps>::processChunk(etl::span<Float const> input, etl::span<Float> output)
+    -> void
+{
+    auto const process = [this](etl::span<Float> buffer) {
+        if constexpr (requires { _processor.process(etl::span<Float const>{buffer}, buffer); }) {
+            _processor.process(buffer, buffer);
+        } else {
+            for (auto& sample : buffer) {
+                sample = _processor(sample);
+            }
+        }
+    };
+
+    if constexpr (stages == 0) {
+        etl::copy(input.begin(), input.end(), output.begin());
+        process(output);
+    } else {
+        // Ping-pong between the scratch buffers, the input is consumed before the output is written.
+        auto size    = input.size() * 2;
+        auto current = etl::span<Float>{_ping};
+        auto next    = etl::span<Float>{_pong};
+        _up[0].process(input, current.first(size));
+        for (auto stage = etl::size_t(1); stage < stages; ++stage) {
+            _up[stage].process(current.first(size), next.first(size * 2));
+            etl::swap(current, next);
+            size *= 2;
+        }
+
+        process(current.first(size));
+
+        for (auto stage = stages - 1; stage > 0; --stage) {
+            _down[stage].process(current.first(size), current.first(size / 2));
+            size /= 2;
+        }
+        _down[0].process(current.first(size), output);
+    }
+}
+
+}  // namespace grit
@@ -0,0 +1,137 @@
+#include "oversampled.hpp"
+
+#include <grit/audio/waveshape/hard_clipper.hpp>
+#include <grit/fft/real_plan.hpp>
+
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/complex.hpp>
+#include <etl/mdspan.hpp>
+#include <etl/numbers.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+namespace {
+
+inline constexpr auto sampleRate = 48'000.0;
+inline constexpr auto fftSize    = etl::size_t(4096);
+
+// Counts the processed calls & the sample rate it was prepared with.
+struct Spy
+{
+    using SampleType = double;
+
+    auto setSampleRate(double sampleRate) -> void { rate = sampleRate; }
+
+    auto reset() -> void { ++resets; }
+
+    [[nodiscard]] auto operator()(double x) -> double
+    {
+        ++calls;
+        return x;
+    }
+
+    double rate{0};
+    int resets{0};
+    int calls{0};
+};
+
+// Energy outside the harmonics of the tone is aliasing. The tone has a whole number of
+// cycles in the fft, after the filters settled, so no window is needed.
+template<typename Processor>
+[[nodiscard]] auto aliasing(Processor& processor, etl::size_t cycles, double drive) -> double
+{
+    auto samples = etl::array<double, fftSize>{};
+    for (auto pass = 0; pass < 2; ++pass) {
+        for (auto i = etl::size_t(0); i < samples.size(); ++i) {
+            auto const phase = double(cycles) * double(i) / double(fftSize);
+            samples[i]       = drive * etl::sin(2.0 * etl::numbers::pi * phase);
+        }
+        processor.process(samples, samples);
+    }
+
+    auto bins = etl::array<etl::complex<double>, fftSize / 2 + 1>{};
+    auto plan = grit::fft::RealPlan<double, fftSize>{};
+    plan(etl::mdspan{samples.data(), etl::extents{fftSize}}, etl::mdspan{bins.data(), etl::extents{bins.size()}});
+
+    auto energy = 0.0;
+    for (auto k = etl::size_t(1); k < bins.size(); ++k) {
+        if (k % cycles != 0) {
+            energy += etl::norm(bins[k]);
+        }
+    }
+    return energy;
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("audio/oversampling: Oversampled", "", float, double)
+{
+    using Float = TestType;
+
+    STATIC_REQUIRE(grit::Oversampled<grit::HardClipper<Float>, 1>::latency() == Float(0));
+    STATIC_REQUIRE(grit::Oversampled<grit::HardClipper<Float>, 2>::latency() == Float(15));
+    STATIC_REQUIRE(grit::Oversampled<grit::HardClipper<Float>, 4>::latency() == Float(22.5));
+    STATIC_REQUIRE(grit::Oversampled<grit::HardClipper<Float>, 8, 8>::latency() == Float(12.25));
+
+    // Block & per sample processing match, across chunk boundaries.
+    auto block     = grit::Oversampled<grit::HardClipper<Float>, 4>{};
+    auto perSample = grit::Oversampled<grit::HardClipper<Float>, 4>{};
+
+    auto buffer = etl::array<Float, 100>{};
+    for (auto i = etl::size_t(0); i < buffer.size(); ++i) {
+        buffer[i] = Float(2) * etl::sin(Float(0.1) * static_cast<Float>(i));
+    }
+    auto const input = buffer;
+    block.process(buffer, buffer);
+
+    for (auto i = etl::size_t(0); i < buffer.size(); ++i) {
+        REQUIRE(buffer[i] == Catch::Approx(perSample(input[i])).margin(1e-6));
+    }
+}
+
+TEST_CASE("audio/oversampling: Oversampled forwards to the processor")
+{
+    auto spy = grit::Oversampled<Spy, 8>{};
+    STATIC_REQUIRE(spy.factor() == 8);
+
+    spy.setSampleRate(sampleRate);
+    REQUIRE(spy.processor().rate == Catch::Approx(sampleRate * 8));
+    REQUIRE(spy.processor().resets == 1);
+
+    auto buffer = etl::array<double, 40>{};
+    spy.process(buffer, buffer);
+    REQUIRE(spy.processor().calls == 40 * 8);
+
+    // A linear processor only sees the latency.
+    auto delay = grit::Oversampled<Spy, 2>{};
+    delay.setSampleRate(sampleRate);
+    for (auto i = 0; i < 256; ++i) {
+        auto const y = delay(etl::sin(0.02 * double(i)));
+        if (i > 64) {
+            REQUIRE(y == Catch::Approx(etl::sin(0.02 * (double(i) - delay.latency()))).margin(1e-3));
+        }
+    }
+}
+
+TEST_CASE("audio/oversampling: Oversampled reduces aliasing")
+{
+    // About 1.25 kHz & 5 kHz at 48 kHz
+    for (auto const cycles : {etl::size_t(107), etl::size_t(433)}) {
+        auto base  = grit::HardClipper<double>{};
+        auto twice = grit::Oversampled<grit::HardClipper<double>, 2>{};
+        auto four  = grit::Oversampled<grit::HardClipper<double>, 4>{};
+        auto long8 = grit::Oversampled<grit::HardClipper<double>, 8, 32>{};
+
+        auto const reference = aliasing(base, cycles, 4.0);
+        auto const x2        = aliasing(twice, cycles, 4.0);
+        auto const x4        = aliasing(four, cycles, 4.0);
+        auto const x8        = aliasing(long8, cycles, 4.0);
+
+        CAPTURE(cycles, reference, x2, x4, x8);
+        REQUIRE(x2 < reference * 0.1);
+        REQUIRE(x4 < x2);
+        REQUIRE(x8 < x4 * 0.25);
+    }
+}
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <grit/audio/stereo/stereo_frame.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
 #include <etl/concepts.hpp>
 #include <etl/mdspan.hpp>
+#include <etl/span.hpp>
 
 namespace grit {
 
@@ -9,4 +14,42 @@ namespace grit {
 template<etl::floating_point Float>
 using StereoBlock = etl::mdspan<Float, etl::extents<etl::size_t, 2, etl::dynamic_extent>, etl::layout_left>;
 
+/// \brief Runs a packed stereo processor over the block in-place.
+/// \details The processor is called with both channels packed into a
+/// StereoFrame, e.g. Biquad<StereoFrame<Float>>. Replaces two mono instances
+/// running in lockstep. Uses the block process() function if available.
+/// \ingroup grit-audio-stereo
+template<etl::floating_point Float, typename Processor>
+auto processStereoFrames(Processor& processor, StereoBlock<Float> const& block) -> void
+{
+    using Frame = StereoFrame<Float>;
+
+    if constexpr (requires(etl::span<Frame> frames) { processor.process(frames, frames); }) {
+        static constexpr auto maxChunkSize = etl::size_t(32);
+
+        auto frames = etl::array<Frame, maxChunkSize>{};
+        for (auto offset = etl::size_t(0); offset < block.extent(1); offset += maxChunkSize) {
+            auto const size  = etl::min(maxChunkSize, block.extent(1) - offset);
+            auto const chunk = etl::span<Frame>{frames}.first(size);
+
+            for (auto i = etl::size_t(0); i < size; ++i) {
+                chunk[i] = Frame{block(0, offset + i), block(1, offset + i)};
+            }
+
+            processor.process(chunk, chunk);
+
+            for (auto i = etl::size_t(0); i < size; ++i) {
+                block(0, offset + i) = chunk[i].left;
+                block(1, offset + i) = chunk[i].right;
+            }
+        }
+    } else {
+        for (auto i = etl::size_t(0); i < block.extent(1); ++i) {
+            auto const out = processor(Frame{block(0, i), block(1, i)});
+            block(0, i)    = out.left;
+            block(1, i)    = out.right;
+        }
+    }
+}
+
 }  // namespace grit
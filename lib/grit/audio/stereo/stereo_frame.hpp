@@ -1,5 +1,8 @@
 #pragma once
 
+#include <etl/cmath.hpp>
+#include <etl/concepts.hpp>
+
 namespace grit {
 
 /// \ingroup grit-audio-stereo
@@ -40,6 +43,26 @@ struct StereoFrame
         };
     }
 
+    friend constexpr auto operator+(Float lhs, StereoFrame rhs) -> StereoFrame { return rhs + lhs; }
+
+    friend constexpr auto operator-(Float lhs, StereoFrame rhs) -> StereoFrame
+    {
+        return {
+            lhs - rhs.left,
+            lhs - rhs.right,
+        };
+    }
+
+    friend constexpr auto operator*(Float lhs, StereoFrame rhs) -> StereoFrame { return rhs * lhs; }
+
+    friend constexpr auto operator-(StereoFrame frame) -> StereoFrame
+    {
+        return {
+            -frame.left,
+            -frame.right,
+        };
+    }
+
     friend constexpr auto operator+(StereoFrame lhs, StereoFrame rhs) -> StereoFrame
     {
         return {
@@ -124,4 +147,40 @@ struct StereoFrame
     Float right{};
 };
 
+/// \ingroup grit-audio-stereo
+template<etl::floating_point Float>
+[[nodiscard]] constexpr auto abs(StereoFrame<Float> frame) -> StereoFrame<Float>
+{
+    return {
+        etl::abs(frame.left),
+        etl::abs(frame.right),
+    };
+}
+
+/// \brief Scalar type of a sample, Float for Float and StereoFrame<Float>.
+/// \ingroup grit-audio-stereo
+template<typename Sample>
+struct SampleTraits
+{
+    using ValueType = Sample;
+};
+
+/// \ingroup grit-audio-stereo
+template<typename Float>
+struct SampleTraits<StereoFrame<Float>>
+{
+    using ValueType = Float;
+};
+
+/// \ingroup grit-audio-stereo
+template<typename Sample>
+using SampleValueType = typename SampleTraits<Sample>::ValueType;
+
+/// \brief A floating point sample or a StereoFrame of them.
+/// \details Processors accepting a StereoFrame run both channels with a
+/// single instance, the left/right state is packed into the two lanes.
+/// \ingroup grit-audio-stereo
+template<typename Sample>
+concept audio_sample = etl::floating_point<SampleValueType<Sample>>;
+
 }  // namespace grit
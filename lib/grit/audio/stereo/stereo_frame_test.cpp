@@ -80,3 +80,38 @@ TEMPLATE_TEST_CASE("audio/stereo: operator/=(StereoFrame)", "[stereo]", float, d
     REQUIRE(result.left == Catch::Approx(0.5));
     REQUIRE(result.right == Catch::Approx(1));
 }
+
+TEMPLATE_TEST_CASE("audio/stereo: operator(Float, StereoFrame)", "[stereo]", float, double)
+{
+    using T          = TestType;
+    auto const frame = StereoFrame<T>{T(1), T(2)};
+
+    auto const sum = T(1) + frame;
+    REQUIRE(sum.left == Catch::Approx(2));
+    REQUIRE(sum.right == Catch::Approx(3));
+
+    auto const diff = T(1) - frame;
+    REQUIRE(diff.left == Catch::Approx(0));
+    REQUIRE(diff.right == Catch::Approx(-1));
+
+    auto const product = T(2) * frame;
+    REQUIRE(product.left == Catch::Approx(2));
+    REQUIRE(product.right == Catch::Approx(4));
+
+    auto const negated = -frame;
+    REQUIRE(negated.left == Catch::Approx(-1));
+    REQUIRE(negated.right == Catch::Approx(-2));
+}
+
+TEMPLATE_TEST_CASE("audio/stereo: abs(StereoFrame)", "[stereo]", float, double)
+{
+    using T           = TestType;
+    auto const result = abs(StereoFrame<T>{T(-1), T(2)});
+    REQUIRE(result.left == Catch::Approx(1));
+    REQUIRE(result.right == Catch::Approx(2));
+
+    STATIC_REQUIRE(audio_sample<T>);
+    STATIC_REQUIRE(audio_sample<StereoFrame<T>>);
+    STATIC_REQUIRE(not audio_sample<int>);
+    STATIC_REQUIRE(etl::same_as<SampleValueType<StereoFrame<T>>, T>);
+}
@@ -10,3 +10,4 @@
 #include <grit/audio/waveshape/tanh_clipper.hpp>
 #include <grit/audio/waveshape/wave_shaper.hpp>
 #include <grit/audio/waveshape/wave_shaper_adaa1.hpp>
+#include <grit/audio/waveshape/wave_shaper_adaa2.hpp>
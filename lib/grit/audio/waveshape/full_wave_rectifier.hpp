@@ -2,6 +2,7 @@
 
 #include <grit/audio/waveshape/wave_shaper.hpp>
 #include <grit/audio/waveshape/wave_shaper_adaa1.hpp>
+#include <grit/audio/waveshape/wave_shaper_adaa2.hpp>
 #include <grit/math/sign.hpp>
 
 namespace grit {
@@ -29,4 +30,8 @@ using FullWaveRectifier = WaveShaper<Float, FullWaveRectifierNonlinearity<Float>
 template<etl::floating_point Float>
 using FullWaveRectifierADAA1 = WaveShaperADAA1<Float, FullWaveRectifierNonlinearity<Float>>;
 
+/// \ingroup grit-audio-waveshape
+template<etl::floating_point Float>
+using FullWaveRectifierADAA2 = WaveShaperADAA2<Float, FullWaveRectifierNonlinearity<Float>>;
+
 }  // namespace grit
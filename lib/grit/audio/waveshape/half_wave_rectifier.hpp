@@ -2,6 +2,7 @@
 
 #include <grit/audio/waveshape/wave_shaper.hpp>
 #include <grit/audio/waveshape/wave_shaper_adaa1.hpp>
+#include <grit/audio/waveshape/wave_shaper_adaa2.hpp>
 
 namespace grit {
 
@@ -31,4 +32,8 @@ using HalfWaveRectifier = WaveShaper<Float, HalfWaveRectifierNonlinearity<Float>
 template<etl::floating_point Float>
 using HalfWaveRectifierADAA1 = WaveShaperADAA1<Float, HalfWaveRectifierNonlinearity<Float>>;
 
+/// \ingroup grit-audio-waveshape
+template<etl::floating_point Float>
+using HalfWaveRectifierADAA2 = WaveShaperADAA2<Float, HalfWaveRectifierNonlinearity<Float>>;
+
 }  // namespace grit
@@ -2,6 +2,7 @@
 
 #include <grit/audio/waveshape/wave_shaper.hpp>
 #include <grit/audio/waveshape/wave_shaper_adaa1.hpp>
+#include <grit/audio/waveshape/wave_shaper_adaa2.hpp>
 #include <grit/math/sign.hpp>
 
 #include <etl/algorithm.hpp>
@@ -20,7 +21,15 @@ struct HardClipperNonlinearity
 
     [[nodiscard]] static constexpr auto ad1(Float x)
     {
-        return etl::abs(x) > Float(1) ? x * sign(x) : (x * x) * Float(0.5);
+        return etl::abs(x) > Float(1) ? x * sign(x) - Float(0.5) : (x * x) * Float(0.5);
+    }
+
+    [[nodiscard]] static constexpr auto ad2(Float x)
+    {
+        if (etl::abs(x) > Float(1)) {
+            return ((x * x) * Float(0.5) + Float(1) / Float(6)) * sign(x) - x * Float(0.5);
+        }
+        return x * x * x * (Float(1) / Float(6));
     }
 };
 
@@ -32,4 +41,8 @@ using HardClipper = WaveShaper<Float, HardClipperNonlinearity<Float>>;
 template<etl::floating_point Float>
 using HardClipperADAA1 = WaveShaperADAA1<Float, HardClipperNonlinearity<Float>>;
 
+/// \ingroup grit-audio-waveshape
+template<etl::floating_point Float>
+using HardClipperADAA2 = WaveShaperADAA2<Float, HardClipperNonlinearity<Float>>;
+
 }  // namespace grit
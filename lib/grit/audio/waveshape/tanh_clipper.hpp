@@ -2,6 +2,8 @@
 
 #include <grit/audio/waveshape/wave_shaper.hpp>
 #include <grit/audio/waveshape/wave_shaper_adaa1.hpp>
+#include <grit/audio/waveshape/wave_shaper_adaa2.hpp>
+#include <grit/math/antiderivative_lookup_table.hpp>
 
 #include <etl/cmath.hpp>
 #include <etl/concepts.hpp>
@@ -30,6 +32,34 @@ struct TanhClipperNonlinearity
     }
 };
 
+/// \brief TanhClipperNonlinearity with f, ad1 & ad2 from a table generated at compile time.
+///
+/// \details tanh has no elementary second antiderivative, the table has
+/// one & replaces the transcendental calls per sample. Beyond +/-8 tanh is
+/// held at its edge value, which is 1 - 2e-7.
+///
+/// \ingroup grit-audio-waveshape
+template<etl::floating_point Float, etl::size_t Size = 1025>
+struct TanhClipperTabulatedNonlinearity
+{
+    constexpr TanhClipperTabulatedNonlinearity() = default;
+
+    [[nodiscard]] constexpr auto operator()(Float x) const -> Float { return f(x); }
+
+    [[nodiscard]] static constexpr auto f(Float x) -> Float { return table(x); }
+
+    [[nodiscard]] static constexpr auto ad1(Float x) -> Float { return table.antiderivative1(x); }
+
+    [[nodiscard]] static constexpr auto ad2(Float x) -> Float { return table.antiderivative2(x); }
+
+private:
+    static constexpr auto const table = AntiderivativeLookupTable<Float, Size>{
+        [](Float x) { return etl::tanh(x); },
+        Float(-8),
+        Float(+8),
+    };
+};
+
 /// \ingroup grit-audio-waveshape
 template<etl::floating_point Float>
 using TanhClipper = WaveShaper<Float, TanhClipperNonlinearity<Float>>;
@@ -38,4 +68,8 @@ using TanhClipper = WaveShaper<Float, TanhClipperNonlinearity<Float>>;
 template<etl::floating_point Float>
 using TanhClipperADAA1 = WaveShaperADAA1<Float, TanhClipperNonlinearity<Float>>;
 
+/// \ingroup grit-audio-waveshape
+template<etl::floating_point Float>
+using TanhClipperADAA2 = WaveShaperADAA2<Float, TanhClipperTabulatedNonlinearity<Float>>;
+
 }  // namespace grit
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <grit/audio/stereo/stereo_frame.hpp>
+
 #include <etl/concepts.hpp>
+#include <etl/span.hpp>
 #include <etl/type_traits.hpp>
 
 namespace grit {
@@ -23,6 +26,24 @@ struct WaveShaper
 
     [[nodiscard]] auto operator()(Float input) const -> Float { return _function(input); }
 
+    /// Applies the function to both lanes.
+    [[nodiscard]] auto operator()(StereoFrame<Float> input) const -> StereoFrame<Float>
+    {
+        return {
+            _function(input.left),
+            _function(input.right),
+        };
+    }
+
+    /// Processes a block of samples. Equivalent to calling operator() on every sample.
+    /// \pre input.size() == output.size(), input & output may alias
+    auto process(etl::span<Float const> input, etl::span<Float> output) const -> void
+    {
+        for (auto i = etl::size_t(0); i < input.size(); ++i) {
+            output[i] = _function(input[i]);
+        }
+    }
+
 private:
     TETL_NO_UNIQUE_ADDRESS Function _function;
 };
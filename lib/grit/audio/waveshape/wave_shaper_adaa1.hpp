@@ -2,6 +2,7 @@
 
 #include <etl/cmath.hpp>
 #include <etl/concepts.hpp>
+#include <etl/span.hpp>
 
 namespace grit {
 
@@ -31,6 +32,27 @@ struct WaveShaperADAA1
         return y;
     }
 
+    /// Processes a block of samples. Equivalent to calling operator() on every sample.
+    /// \pre input.size() == output.size(), input & output may alias
+    constexpr auto process(etl::span<Float const> input, etl::span<Float> output) -> void
+    {
+        auto xm1   = _xm1;
+        auto ad1m1 = _ad1m1;
+
+        for (auto i = etl::size_t(0); i < input.size(); ++i) {
+            auto const x        = input[i];
+            auto const tooSmall = etl::abs(x - xm1) < tolerance;
+            auto const ad1      = _nl.ad1(x);
+            output[i]           = tooSmall ? _nl.f((x + xm1) * Float(0.5)) : (ad1 - ad1m1) / (x - xm1);
+
+            xm1   = x;
+            ad1m1 = ad1;
+        }
+
+        _xm1   = xm1;
+        _ad1m1 = ad1m1;
+    }
+
 private:
     static constexpr auto const tolerance = Float(1e-3);
 
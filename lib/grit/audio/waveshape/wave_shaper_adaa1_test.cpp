@@ -2,6 +2,8 @@
 #include "half_wave_rectifier.hpp"
 #include "hard_clipper.hpp"
 
+#include <etl/array.hpp>
+
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 
@@ -27,3 +29,32 @@ TEMPLATE_PRODUCT_TEST_CASE(
     REQUIRE(shaper(0.1) == Catch::Approx(0.1));
     REQUIRE(shaper(0.1) == Catch::Approx(0.1));
 }
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "audio/waveshape: WaveShaperADAA1::process",
+    "",
+    (grit::FullWaveRectifierADAA1, grit::HalfWaveRectifierADAA1, grit::HardClipperADAA1),
+    (float, double)
+)
+{
+    using Waveshaper = TestType;
+    using Float      = typename Waveshaper::SampleType;
+
+    auto reference = Waveshaper{};
+    auto block     = Waveshaper{};
+
+    auto buffer = etl::array<Float, 32>{};
+    for (auto i = size_t(0); i < buffer.size(); ++i) {
+        buffer[i] = Float(2) * static_cast<Float>(i % 8) / Float(8) - Float(1);
+    }
+
+    auto expected = buffer;
+    for (auto& x : expected) {
+        x = reference(x);
+    }
+
+    block.process(buffer, buffer);
+    for (auto i = size_t(0); i < buffer.size(); ++i) {
+        REQUIRE(buffer[i] == Catch::Approx(expected[i]));
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <etl/cmath.hpp>
+#include <etl/concepts.hpp>
+#include <etl/span.hpp>
+
+namespace grit {
+
+/// \brief Waveshaper with second order antiderivative antialiasing.
+///
+/// \details Needs f, ad1 & ad2 from the nonlinearity. Suppresses aliasing
+/// better than WaveShaperADAA1 at the cost of one sample of delay. The second
+/// order difference cancels a lot of digits, so near-equal inputs switch to
+/// the first order fallbacks with a larger tolerance in single precision.
+///
+/// \ingroup grit-audio-waveshape
+template<etl::floating_point Float, typename Nonlinearity>
+struct WaveShaperADAA2
+{
+    using SampleType = Float;
+
+    constexpr WaveShaperADAA2() = default;
+
+    constexpr auto reset() -> void
+    {
+        _xm1 = Float(0);
+        _xm2 = Float(0);
+        _d1  = Float(0);
+    }
+
+    [[nodiscard]] constexpr auto operator()(Float x) -> Float
+    {
+        auto const d = difference(x, _xm1);
+        auto const y = etl::abs(x - _xm2) < tolerance ? fallback(x, _xm1, _xm2)
+                                                      : Float(2) * (d - _d1) / (x - _xm2);
+
+        _xm2 = _xm1;
+        _xm1 = x;
+        _d1  = d;
+
+        return y;
+    }
+
+    /// Processes a block of samples. Equivalent to calling operator() on every sample.
+    /// \pre input.size() == output.size(), input & output may alias
+    constexpr auto process(etl::span<Float const> input, etl::span<Float> output) -> void
+    {
+        for (auto i = etl::size_t(0); i < input.size(); ++i) {
+            output[i] = (*this)(input[i]);
+        }
+    }
+
+private:
+    static constexpr auto const tolerance = etl::same_as<Float, float> ? Float(1e-2) : Float(1e-5);
+
+    /// First divided difference of ad2, which is ad1 at the midpoint if x0 & x1 are too close.
+    [[nodiscard]] constexpr auto difference(Float x0, Float x1) const -> Float
+    {
+        if (etl::abs(x0 - x1) < tolerance) {
+            return _nl.ad1((x0 + x1) * Float(0.5));
+        }
+        return (_nl.ad2(x0) - _nl.ad2(x1)) / (x0 - x1);
+    }
+
+    /// Limit for x == xm2, with both replaced by their midpoint.
+    [[nodiscard]] constexpr auto fallback(Float x, Float xm1, Float xm2) const -> Float
+    {
+        auto const mid   = (x + xm2) * Float(0.5);
+        auto const delta = mid - xm1;
+        if (etl::abs(delta) < tolerance) {
+            return _nl.f((mid + xm1) * Float(0.5));
+        }
+        return Float(2) / delta * (_nl.ad1(mid) + (_nl.ad2(xm1) - _nl.ad2(mid)) / delta);
+    }
+
+    Float _xm1{0};
+    Float _xm2{0};
+    Float _d1{0};
+    TETL_NO_UNIQUE_ADDRESS Nonlinearity _nl;
+};
+
+}  // namespace grit
@@ -0,0 +1,138 @@
+#include "full_wave_rectifier.hpp"
+#include "half_wave_rectifier.hpp"
+#include "hard_clipper.hpp"
+#include "tanh_clipper.hpp"
+
+#include <grit/fft/real_plan.hpp>
+
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/complex.hpp>
+#include <etl/mdspan.hpp>
+#include <etl/numbers.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+namespace {
+
+// A slow input comes out as the nonlinearity, one sample late.
+template<typename Shaper, typename Function>
+auto requireFollowsSlowInput(Function f, double margin) -> void
+{
+    using Float = typename Shaper::SampleType;
+
+    auto shaper = Shaper{};
+    auto xm1    = Float(0);
+    for (auto i = 0; i < 1'000; ++i) {
+        auto const x = Float(1.5) * etl::sin(Float(0.01) * static_cast<Float>(i));
+        auto const y = shaper(x);
+        if (i > 2) {
+            CAPTURE(i, x);
+            REQUIRE(y == Catch::Approx(f(xm1)).margin(margin));
+        }
+        xm1 = x;
+    }
+}
+
+// Energy outside the harmonics relative to the fundamental. The tone has a whole
+// number of cycles in the fft, so no window is needed.
+template<typename Shaper>
+[[nodiscard]] auto aliasing(etl::size_t cycles, double drive) -> double
+{
+    static constexpr auto fftSize = etl::size_t(4096);
+
+    auto shaper  = Shaper{};
+    auto samples = etl::array<double, fftSize>{};
+    for (auto pass = 0; pass < 2; ++pass) {
+        for (auto i = etl::size_t(0); i < samples.size(); ++i) {
+            auto const phase = double(cycles) * double(i) / double(fftSize);
+            samples[i]       = shaper(drive * etl::sin(2.0 * etl::numbers::pi * phase));
+        }
+    }
+
+    auto bins = etl::array<etl::complex<double>, fftSize / 2 + 1>{};
+    auto plan = grit::fft::RealPlan<double, fftSize>{};
+    plan(etl::mdspan{samples.data(), etl::extents{fftSize}}, etl::mdspan{bins.data(), etl::extents{bins.size()}});
+
+    auto energy = 0.0;
+    for (auto k = etl::size_t(1); k < bins.size(); ++k) {
+        if (k % cycles != 0) {
+            energy += etl::norm(bins[k]);
+        }
+    }
+    return energy / etl::norm(bins[cycles]);
+}
+
+}  // namespace
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "audio/waveshape: WaveShaperADAA2",
+    "",
+    (grit::FullWaveRectifierADAA2, grit::HalfWaveRectifierADAA2, grit::HardClipperADAA2, grit::TanhClipperADAA2),
+    (float, double)
+)
+{
+    using Waveshaper = TestType;
+    using Float      = typename Waveshaper::SampleType;
+
+    auto shaper = Waveshaper{};
+    STATIC_REQUIRE(sizeof(shaper) == sizeof(Float) * 3);
+
+    // A constant input settles on the nonlinearity.
+    for (auto i = 0; i < 3; ++i) {
+        (void)shaper(Float(0.5));
+    }
+    REQUIRE(shaper(Float(0.5)) == Catch::Approx(0.5).margin(0.04));
+
+    // Block & per sample processing match.
+    auto reference = Waveshaper{};
+    auto block     = Waveshaper{};
+
+    auto buffer = etl::array<Float, 64>{};
+    for (auto i = size_t(0); i < buffer.size(); ++i) {
+        buffer[i] = Float(3) * etl::sin(Float(0.3) * static_cast<Float>(i));
+    }
+    buffer[10] = buffer[11] = buffer[12];
+
+    auto expected = buffer;
+    for (auto& x : expected) {
+        x = reference(x);
+    }
+
+    block.process(buffer, buffer);
+    for (auto i = size_t(0); i < buffer.size(); ++i) {
+        REQUIRE(etl::isfinite(buffer[i]));
+        REQUIRE(buffer[i] == Catch::Approx(expected[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/waveshape: WaveShaperADAA2 follows a slow input", "", float, double)
+{
+    using Float = TestType;
+
+    // The corners are smoothed over about one sample step of the input, 0.015.
+    auto const kink = 0.01;
+    requireFollowsSlowInput<grit::FullWaveRectifierADAA2<Float>>(grit::FullWaveRectifierNonlinearity<Float>::f, kink);
+    requireFollowsSlowInput<grit::HalfWaveRectifierADAA2<Float>>(grit::HalfWaveRectifierNonlinearity<Float>::f, kink);
+    requireFollowsSlowInput<grit::HardClipperADAA2<Float>>(grit::HardClipperNonlinearity<Float>::f, kink);
+
+    auto const smooth = etl::same_as<Float, float> ? 1e-3 : 1e-4;
+    requireFollowsSlowInput<grit::TanhClipperADAA2<Float>>(grit::TanhClipperNonlinearity<Float>::f, smooth);
+}
+
+TEST_CASE("audio/waveshape: WaveShaperADAA2 aliasing")
+{
+    // About 5 kHz & 11.7 kHz at 48 kHz
+    for (auto const cycles : {etl::size_t(433), etl::size_t(1001)}) {
+        auto const adaa1 = aliasing<grit::TanhClipperADAA1<double>>(cycles, 4.0);
+        auto const adaa2 = aliasing<grit::TanhClipperADAA2<double>>(cycles, 4.0);
+        CAPTURE(cycles, adaa1, adaa2);
+        REQUIRE(adaa2 < adaa1 * 0.5);
+
+        auto const hard1 = aliasing<grit::HardClipperADAA1<double>>(cycles, 4.0);
+        auto const hard2 = aliasing<grit::HardClipperADAA2<double>>(cycles, 4.0);
+        CAPTURE(hard1, hard2);
+        REQUIRE(hard2 < hard1 * 0.5);
+    }
+}
@@ -25,3 +25,21 @@ TEMPLATE_PRODUCT_TEST_CASE(
     REQUIRE(shaper(Float(0.1)) == Catch::Approx(0.1));
     REQUIRE(shaper(Float(0.1)) == Catch::Approx(0.1));
 }
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "audio/waveshape: WaveShaper(StereoFrame)",
+    "",
+    (grit::FullWaveRectifier, grit::HalfWaveRectifier, grit::HardClipper),
+    (float, double)
+)
+{
+    using WaveShaper = TestType;
+    using Float      = typename WaveShaper::SampleType;
+
+    auto shaper = WaveShaper{};
+    for (auto const x : {Float(-2), Float(-0.5), Float(0), Float(0.25), Float(1.5)}) {
+        auto const y = shaper(grit::StereoFrame<Float>{x, -x});
+        REQUIRE(y.left == Catch::Approx(shaper(x)));
+        REQUIRE(y.right == Catch::Approx(shaper(-x)));
+    }
+}
@@ -15,46 +15,145 @@
 
 namespace grit::arm {
 
+namespace detail {
+
+// Halfwords of a packed 16-bit pair & the wrapping result of the 32-bit instructions,
+// the portable fallbacks below are bit exact to the instructions.
+[[nodiscard]] constexpr auto bottom(etl::uint32_t x) -> etl::int32_t
+{
+    return static_cast<etl::int16_t>(x & etl::uint32_t(0xFFFF));
+}
+
+[[nodiscard]] constexpr auto top(etl::uint32_t x) -> etl::int32_t { return static_cast<etl::int16_t>(x >> 16U); }
+
+[[nodiscard]] constexpr auto pack(etl::int32_t bottom, etl::int32_t top) -> etl::uint32_t
+{
+    return (static_cast<etl::uint32_t>(bottom) & etl::uint32_t(0xFFFF)) | (static_cast<etl::uint32_t>(top) << 16U);
+}
+
+[[nodiscard]] constexpr auto saturate16(etl::int32_t x) -> etl::int32_t
+{
+    return etl::clamp(x, TA_Q15_MIN, TA_Q15_MAX);
+}
+
+[[nodiscard]] constexpr auto wrap(etl::int64_t x) -> etl::uint32_t { return static_cast<etl::uint32_t>(x); }
+
+}  // namespace detail
+
+/// Saturating add of both signed halfwords.
 TA_ALWAYS_INLINE inline auto qadd16(etl::uint32_t op1, etl::uint32_t op2) -> etl::uint32_t
 {
+#if __arm__
     auto result = etl::uint32_t{};
     __asm volatile("qadd16 %0, %1, %2" : "=r"(result) : "r"(op1), "r"(op2));
     return result;
+#else
+    using namespace detail;
+    return pack(saturate16(bottom(op1) + bottom(op2)), saturate16(top(op1) + top(op2)));
+#endif
 }
 
+/// Saturating subtract of both signed halfwords.
 TA_ALWAYS_INLINE inline auto qsub16(etl::uint32_t op1, etl::uint32_t op2) -> etl::uint32_t
 {
+#if __arm__
     auto result = etl::uint32_t{};
     __asm volatile("qsub16 %0, %1, %2" : "=r"(result) : "r"(op1), "r"(op2));
     return result;
+#else
+    using namespace detail;
+    return pack(saturate16(bottom(op1) - bottom(op2)), saturate16(top(op1) - top(op2)));
+#endif
 }
 
+/// bottom * bottom + top * top
 TA_ALWAYS_INLINE inline auto smuad(etl::uint32_t op1, etl::uint32_t op2) -> etl::uint32_t
 {
+#if __arm__
     auto result = etl::uint32_t{};
     __asm volatile("smuad %0, %1, %2" : "=r"(result) : "r"(op1), "r"(op2));
     return result;
+#else
+    using namespace detail;
+    return wrap(etl::int64_t(bottom(op1)) * bottom(op2) + etl::int64_t(top(op1)) * top(op2));
+#endif
 }
 
+/// bottom * top + top * bottom
 TA_ALWAYS_INLINE inline auto smuadx(etl::uint32_t op1, etl::uint32_t op2) -> etl::uint32_t
 {
+#if __arm__
     auto result = etl::uint32_t{};
     __asm volatile("smuadx %0, %1, %2" : "=r"(result) : "r"(op1), "r"(op2));
     return result;
+#else
+    using namespace detail;
+    return wrap(etl::int64_t(bottom(op1)) * top(op2) + etl::int64_t(top(op1)) * bottom(op2));
+#endif
 }
 
+/// bottom * bottom - top * top
 TA_ALWAYS_INLINE inline auto smusd(etl::uint32_t op1, etl::uint32_t op2) -> etl::uint32_t
 {
+#if __arm__
     auto result = etl::uint32_t{};
     __asm volatile("smusd %0, %1, %2" : "=r"(result) : "r"(op1), "r"(op2));
     return result;
+#else
+    using namespace detail;
+    return wrap(etl::int64_t(bottom(op1)) * bottom(op2) - etl::int64_t(top(op1)) * top(op2));
+#endif
 }
 
+/// bottom * top - top * bottom
 TA_ALWAYS_INLINE inline auto smusdx(etl::uint32_t op1, etl::uint32_t op2) -> etl::uint32_t
 {
+#if __arm__
     auto result = etl::uint32_t{};
     __asm volatile("smusdx %0, %1, %2" : "=r"(result) : "r"(op1), "r"(op2));
     return result;
+#else
+    using namespace detail;
+    return wrap(etl::int64_t(bottom(op1)) * top(op2) - etl::int64_t(top(op1)) * bottom(op2));
+#endif
+}
+
+/// acc + bottom * bottom + top * top, the dual 16-bit multiply-accumulate.
+TA_ALWAYS_INLINE inline auto smlad(etl::uint32_t op1, etl::uint32_t op2, etl::uint32_t acc) -> etl::uint32_t
+{
+#if __arm__
+    auto result = etl::uint32_t{};
+    __asm volatile("smlad %0, %1, %2, %3" : "=r"(result) : "r"(op1), "r"(op2), "r"(acc));
+    return result;
+#else
+    using namespace detail;
+    auto const sum = etl::int64_t(bottom(op1)) * bottom(op2) + etl::int64_t(top(op1)) * top(op2);
+    return wrap(static_cast<etl::int32_t>(acc) + sum);
+#endif
+}
+
+/// Saturating 32-bit add.
+TA_ALWAYS_INLINE inline auto qadd(etl::int32_t op1, etl::int32_t op2) -> etl::int32_t
+{
+#if __arm__
+    auto result = etl::int32_t{};
+    __asm volatile("qadd %0, %1, %2" : "=r"(result) : "r"(op1), "r"(op2));
+    return result;
+#else
+    return static_cast<etl::int32_t>(etl::clamp(etl::int64_t(op1) + op2, TA_Q31_MIN, TA_Q31_MAX));
+#endif
+}
+
+/// Saturating 32-bit subtract.
+TA_ALWAYS_INLINE inline auto qsub(etl::int32_t op1, etl::int32_t op2) -> etl::int32_t
+{
+#if __arm__
+    auto result = etl::int32_t{};
+    __asm volatile("qsub %0, %1, %2" : "=r"(result) : "r"(op1), "r"(op2));
+    return result;
+#else
+    return static_cast<etl::int32_t>(etl::clamp(etl::int64_t(op1) - op2, TA_Q31_MIN, TA_Q31_MAX));
+#endif
 }
 
 TA_ALWAYS_INLINE inline auto ssat16(etl::int32_t x) -> etl::int16_t
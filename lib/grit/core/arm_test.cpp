@@ -0,0 +1,56 @@
+#include "arm.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+constexpr auto pair(etl::int16_t bottom, etl::int16_t top) -> etl::uint32_t
+{
+    return grit::arm::pkhbt(bottom, top, 16);
+}
+
+}  // namespace
+
+TEST_CASE("core: arm")
+{
+    SECTION("qadd16/qsub16")
+    {
+        REQUIRE(grit::arm::qadd16(pair(1, -2), pair(3, 4)) == pair(4, 2));
+        REQUIRE(grit::arm::qadd16(pair(32'000, -32'000), pair(1'000, -1'000)) == pair(32'767, -32'768));
+        REQUIRE(grit::arm::qsub16(pair(1, -2), pair(3, 4)) == pair(-2, -6));
+        REQUIRE(grit::arm::qsub16(pair(-32'000, 32'000), pair(1'000, -1'000)) == pair(-32'768, 32'767));
+    }
+
+    SECTION("smuad/smusd")
+    {
+        REQUIRE(static_cast<etl::int32_t>(grit::arm::smuad(pair(2, 3), pair(5, -7))) == 2 * 5 + 3 * -7);
+        REQUIRE(static_cast<etl::int32_t>(grit::arm::smuadx(pair(2, 3), pair(5, -7))) == 2 * -7 + 3 * 5);
+        REQUIRE(static_cast<etl::int32_t>(grit::arm::smusd(pair(2, 3), pair(5, -7))) == 2 * 5 - 3 * -7);
+        REQUIRE(static_cast<etl::int32_t>(grit::arm::smusdx(pair(2, 3), pair(5, -7))) == 2 * -7 - 3 * 5);
+
+        // The only overflowing case of the instruction wraps around.
+        auto const min = pair(-32'768, -32'768);
+        REQUIRE(grit::arm::smuad(min, min) == etl::uint32_t(0x80000000));
+    }
+
+    SECTION("smlad")
+    {
+        auto const acc = static_cast<etl::uint32_t>(-100);
+        REQUIRE(static_cast<etl::int32_t>(grit::arm::smlad(pair(2, 3), pair(5, -7), acc)) == -100 + 10 - 21);
+    }
+
+    SECTION("qadd/qsub")
+    {
+        REQUIRE(grit::arm::qadd(1, 2) == 3);
+        REQUIRE(grit::arm::qadd(2'147'483'000, 1'000) == 2'147'483'647);
+        REQUIRE(grit::arm::qsub(-2'147'483'000, 1'000) == -2'147'483'647 - 1);
+    }
+
+    SECTION("ssat16/pkhbt")
+    {
+        REQUIRE(grit::arm::ssat16(40'000) == 32'767);
+        REQUIRE(grit::arm::ssat16(-40'000) == -32'768);
+        REQUIRE(grit::arm::ssat16(123) == 123);
+        REQUIRE(grit::arm::pkhbt(-1, 2, 16) == etl::uint32_t(0x0002FFFF));
+    }
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <grit/core/cycle_counter.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/atomic.hpp>
+#include <etl/cmath.hpp>
+#include <etl/cstddef.hpp>
+#include <etl/cstdint.hpp>
+#include <etl/limits.hpp>
+
+namespace grit {
+
+/// \brief Load of the audio callback relative to the block period.
+///
+/// \details begin() & end() bracket the callback. A load of 1 means the
+/// callback took the whole block period, anything above is counted as an
+/// overrun of the deadline. The load is smoothed with a one pole over
+/// smoothingTime, the peak holds the largest single callback until the main
+/// loop takes it.
+///
+/// The results are atomics with the callback as the only writer, the main
+/// loop reads them without ever blocking the audio. Clock needs a static
+/// now() returning ticks as a wrapping uint32, CycleCounter on the hardware.
+///
+/// \ingroup grit-core
+template<typename Clock = CycleCounter>
+struct CallbackLoadMonitor
+{
+    /// Time constant of the smoothed load in seconds.
+    static constexpr auto smoothingTime = 0.5F;
+
+    CallbackLoadMonitor() = default;
+
+    /// \param clockRate Ticks of Clock per second, the core clock for CycleCounter.
+    auto prepare(float sampleRate, etl::size_t blockSize, float clockRate) -> void;
+
+    auto begin() -> void { _start = Clock::now(); }
+
+    auto end() -> void;
+
+    /// Smoothed load, safe to call from the main loop.
+    [[nodiscard]] auto load() const -> float { return _load.load(etl::memory_order_relaxed); }
+
+    /// Largest load since the last call, safe to call from the main loop.
+    [[nodiscard]] auto takePeak() -> float { return _peak.exchange(0.0F, etl::memory_order_relaxed); }
+
+    /// Number of callbacks that missed the deadline, safe to call from the main loop.
+    [[nodiscard]] auto overruns() const -> etl::uint32_t { return _overruns.load(etl::memory_order_relaxed); }
+
+private:
+    float _scale{0};
+    float _coefficient{1};
+    etl::uint32_t _period{etl::numeric_limits<etl::uint32_t>::max()};
+    etl::uint32_t _start{0};
+
+    etl::atomic<float> _load{0};
+    etl::atomic<float> _peak{0};
+    etl::atomic<etl::uint32_t> _overruns{0};
+};
+
+template<typename Clock>
+auto CallbackLoadMonitor<Clock>::prepare(float sampleRate, etl::size_t blockSize, float clockRate) -> void
+{
+    auto const blockPeriod = static_cast<float>(blockSize) / sampleRate;
+
+    _period      = static_cast<etl::uint32_t>(blockPeriod * clockRate);
+    _scale       = 1.0F / static_cast<float>(_period);
+    _coefficient = 1.0F - etl::exp(-blockPeriod / smoothingTime);
+
+    _load.store(0.0F, etl::memory_order_relaxed);
+    _peak.store(0.0F, etl::memory_order_relaxed);
+    _overruns.store(0, etl::memory_order_relaxed);
+}
+
+template<typename Clock>
+auto CallbackLoadMonitor<Clock>::end() -> void
+{
+    auto const elapsed = Clock::now() - _start;
+    auto const load    = static_cast<float>(elapsed) * _scale;
+
+    auto const smoothed = _load.load(etl::memory_order_relaxed);
+    _load.store(smoothed + (load - smoothed) * _coefficient, etl::memory_order_relaxed);
+
+    // The main loop may reset the peak between the load & the store.
+    auto peak = _peak.load(etl::memory_order_relaxed);
+    while (load > peak and not _peak.compare_exchange_weak(peak, load, etl::memory_order_relaxed)) {}
+
+    if (elapsed > _period) {
+        _overruns.store(_overruns.load(etl::memory_order_relaxed) + 1, etl::memory_order_relaxed);
+    }
+}
+
+}  // namespace grit
@@ -0,0 +1,64 @@
+#include "callback_load_monitor.hpp"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+namespace {
+
+struct SimulatedClock
+{
+    [[nodiscard]] static auto now() -> etl::uint32_t { return ticks; }
+
+    static inline auto ticks = etl::uint32_t(0);
+};
+
+// 32 samples at 96 kHz on a 480 MHz clock, 160'000 ticks per block.
+auto runCallback(grit::CallbackLoadMonitor<SimulatedClock>& monitor, etl::uint32_t duration) -> void
+{
+    monitor.begin();
+    SimulatedClock::ticks += duration;
+    monitor.end();
+    SimulatedClock::ticks += 160'000 - etl::min(duration, etl::uint32_t(160'000));
+}
+
+}  // namespace
+
+TEST_CASE("core: CallbackLoadMonitor")
+{
+    SimulatedClock::ticks = GENERATE(etl::uint32_t(0), etl::uint32_t(0xFFFF'0000));
+
+    auto monitor = grit::CallbackLoadMonitor<SimulatedClock>{};
+    monitor.prepare(96'000.0F, 32, 480'000'000.0F);
+    REQUIRE(monitor.load() == 0.0F);
+    REQUIRE(monitor.takePeak() == 0.0F);
+    REQUIRE(monitor.overruns() == 0);
+
+    // Converges to a quarter of the block period, across the clock wrap around.
+    for (auto i = 0; i < 12'000; ++i) {
+        runCallback(monitor, 40'000);
+    }
+    REQUIRE(monitor.load() == Catch::Approx(0.25F).margin(1e-3));
+    REQUIRE(monitor.takePeak() == Catch::Approx(0.25F));
+    REQUIRE(monitor.takePeak() == 0.0F);
+    REQUIRE(monitor.overruns() == 0);
+
+    // A single spike shows in the peak & barely in the smoothed load.
+    runCallback(monitor, 120'000);
+    REQUIRE(monitor.load() < 0.26F);
+    REQUIRE(monitor.takePeak() == Catch::Approx(0.75F));
+    REQUIRE(monitor.overruns() == 0);
+
+    // Only callbacks longer than the block period miss the deadline.
+    runCallback(monitor, 160'000);
+    REQUIRE(monitor.overruns() == 0);
+    runCallback(monitor, 200'000);
+    runCallback(monitor, 320'000);
+    REQUIRE(monitor.overruns() == 2);
+    REQUIRE(monitor.takePeak() == Catch::Approx(2.0F));
+
+    // The counters start over.
+    monitor.prepare(96'000.0F, 32, 480'000'000.0F);
+    REQUIRE(monitor.load() == 0.0F);
+    REQUIRE(monitor.overruns() == 0);
+}
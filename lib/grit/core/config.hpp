@@ -7,3 +7,11 @@
 #else
     #define TA_ALWAYS_INLINE
 #endif
+
+// Zero initialized storage in the external SDRAM of the Daisy. The section is
+// provided by the libDaisy linker script, host builds use regular memory.
+#if defined(__arm__)
+    #define TA_SDRAM_BSS __attribute__((section(".sdram_bss")))
+#else
+    #define TA_SDRAM_BSS
+#endif
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <etl/cstdint.hpp>
+
+#if not defined(__arm__) and not defined(__x86_64__) and not defined(__i386__) and not defined(__aarch64__)
+    #include <chrono>
+#endif
+
+namespace grit {
+
+/// \brief Free running 32-bit cycle counter.
+///
+/// \details On the Cortex-M7 this reads the DWT CYCCNT register, which counts
+/// core clock cycles & wraps after about 9 seconds at 480 MHz. Host builds use
+/// the time stamp counter on x86, the virtual counter on AArch64 & nanoseconds
+/// of the steady clock everywhere else. Only differences between two reads
+/// are meaningful, the unsigned subtraction handles the wrap around.
+///
+/// \ingroup grit-core
+struct CycleCounter
+{
+    /// Turns the counter on, required once after reset on the Cortex-M7.
+    static auto enable() -> void;
+
+    [[nodiscard]] static auto now() -> etl::uint32_t;
+};
+
+inline auto CycleCounter::enable() -> void
+{
+#if defined(__arm__)
+    auto* const demcr   = reinterpret_cast<etl::uint32_t volatile*>(0xE000EDFC);
+    auto* const control = reinterpret_cast<etl::uint32_t volatile*>(0xE0001000);
+    auto* const cyccnt  = reinterpret_cast<etl::uint32_t volatile*>(0xE0001004);
+    auto* const lock    = reinterpret_cast<etl::uint32_t volatile*>(0xE0001FB0);
+
+    *demcr   = *demcr | (etl::uint32_t(1) << 24U);  // TRCENA
+    *lock    = etl::uint32_t(0xC5ACCE55);
+    *cyccnt  = 0;
+    *control = *control | etl::uint32_t(1);  // CYCCNTENA
+#endif
+}
+
+inline auto CycleCounter::now() -> etl::uint32_t
+{
+#if defined(__arm__)
+    return *reinterpret_cast<etl::uint32_t volatile const*>(0xE0001004);
+#elif defined(__x86_64__) or defined(__i386__)
+    return static_cast<etl::uint32_t>(__builtin_ia32_rdtsc());
+#elif defined(__aarch64__)
+    auto ticks = etl::uint64_t{};
+    __asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return static_cast<etl::uint32_t>(ticks);
+#else
+    auto const elapsed = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<etl::uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+#endif
+}
+
+}  // namespace grit
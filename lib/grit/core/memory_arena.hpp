@@ -0,0 +1,58 @@
+#pragma once
+
+#include <etl/algorithm.hpp>
+#include <etl/cstddef.hpp>
+#include <etl/cstdint.hpp>
+#include <etl/span.hpp>
+#include <etl/type_traits.hpp>
+
+namespace grit {
+
+/// \brief Bump allocator over a caller provided region.
+///
+/// \details Hands out zeroed, aligned spans while setting up the processors.
+/// Nothing is freed individually, reset() releases everything at once. The
+/// arena doesn't own the memory. On the Daisy it's a TA_SDRAM_BSS array in
+/// external SDRAM, host builds & tests pass in heap memory.
+///
+/// \ingroup grit-core
+struct MemoryArena
+{
+    explicit MemoryArena(etl::span<etl::byte> memory) : _memory{memory} {}
+
+    [[nodiscard]] auto capacity() const -> etl::size_t { return _memory.size(); }
+
+    [[nodiscard]] auto used() const -> etl::size_t { return _used; }
+
+    /// Returns an empty span if the request doesn't fit.
+    template<typename T>
+        requires(etl::is_trivially_default_constructible_v<T> and etl::is_trivially_destructible_v<T>)
+    [[nodiscard]] auto allocate(etl::size_t count) -> etl::span<T>;
+
+    auto reset() -> void { _used = 0; }
+
+private:
+    etl::span<etl::byte> _memory;
+    etl::size_t _used{0};
+};
+
+template<typename T>
+    requires(etl::is_trivially_default_constructible_v<T> and etl::is_trivially_destructible_v<T>)
+auto MemoryArena::allocate(etl::size_t count) -> etl::span<T>
+{
+    auto const base    = reinterpret_cast<etl::uintptr_t>(_memory.data());
+    auto const address = (base + _used + alignof(T) - 1) & ~(etl::uintptr_t(alignof(T)) - 1);
+    auto const offset  = static_cast<etl::size_t>(address - base);
+
+    if (offset > _memory.size() or count > (_memory.size() - offset) / sizeof(T)) {
+        return {};
+    }
+
+    _used = offset + count * sizeof(T);
+
+    auto* const first = reinterpret_cast<T*>(_memory.data() + offset);
+    etl::fill_n(first, count, T{});
+    return {first, count};
+}
+
+}  // namespace grit
@@ -0,0 +1,38 @@
+#include "memory_arena.hpp"
+
+#include <etl/cstddef.hpp>
+#include <etl/cstdint.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+TEST_CASE("core: MemoryArena")
+{
+    auto memory = std::vector<etl::byte>(64, etl::byte(0xFF));
+    auto arena  = grit::MemoryArena{memory};
+    REQUIRE(arena.capacity() == 64);
+    REQUIRE(arena.used() == 0);
+
+    auto bytes = arena.allocate<char>(3);
+    REQUIRE(bytes.size() == 3);
+    REQUIRE(arena.used() == 3);
+
+    // Aligned & zeroed
+    auto floats = arena.allocate<float>(4);
+    REQUIRE(floats.size() == 4);
+    REQUIRE(reinterpret_cast<etl::uintptr_t>(floats.data()) % alignof(float) == 0);
+    REQUIRE(floats[0] == 0.0F);
+    REQUIRE(floats[3] == 0.0F);
+    REQUIRE(static_cast<void*>(floats.data()) > static_cast<void*>(bytes.data()));
+
+    // Too large, nothing is taken
+    auto const used = arena.used();
+    REQUIRE(arena.allocate<double>(64).empty());
+    REQUIRE(arena.used() == used);
+
+    arena.reset();
+    REQUIRE(arena.used() == 0);
+    REQUIRE(arena.allocate<etl::byte>(64).size() == 64);
+    REQUIRE(arena.allocate<etl::byte>(1).empty());
+}
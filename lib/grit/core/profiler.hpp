@@ -0,0 +1,129 @@
+#pragma once
+
+#include <grit/core/cycle_counter.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/atomic.hpp>
+#include <etl/cstddef.hpp>
+#include <etl/cstdint.hpp>
+#include <etl/limits.hpp>
+
+namespace grit {
+
+/// \brief Cycle statistics of one profiler zone.
+/// \ingroup grit-core
+struct ProfileStats
+{
+    etl::uint32_t calls{0};
+    etl::uint32_t min{etl::numeric_limits<etl::uint32_t>::max()};
+    etl::uint32_t max{0};
+    etl::uint64_t total{0};
+
+    auto add(etl::uint32_t cycles) -> void;
+
+    [[nodiscard]] auto average() const -> etl::uint32_t;
+};
+
+/// \brief Fixed size table of zone statistics, filled from the audio callback.
+///
+/// \details Zones are identified by index, usually an enum of the processor.
+/// The audio side records into a working table & calls publish() once per
+/// block. If the main loop has drained the previous snapshot, the working
+/// table is handed over & started fresh, otherwise it keeps accumulating.
+/// The handover is a single atomic flag, neither side ever waits.
+///
+/// \ingroup grit-core
+template<etl::size_t Zones>
+struct Profiler
+{
+    Profiler() = default;
+
+    [[nodiscard]] static constexpr auto zones() -> etl::size_t { return Zones; }
+
+    /// Audio side, adds one call of a zone.
+    auto record(etl::size_t zone, etl::uint32_t cycles) -> void { _working[zone].add(cycles); }
+
+    /// Audio side, offers the working table to the main loop.
+    auto publish() -> void;
+
+    /// Main loop side, calls func(zone, stats) for every zone with at least
+    /// one call since the last drain. Returns false if nothing was published.
+    template<typename Func>
+    auto drain(Func func) -> bool;
+
+private:
+    etl::array<ProfileStats, Zones> _working{};
+    etl::array<ProfileStats, Zones> _published{};
+    etl::atomic<bool> _ready{false};
+};
+
+/// \brief Records the cycles from construction to destruction into a profiler zone.
+/// \ingroup grit-core
+template<etl::size_t Zones>
+struct ScopedProfile
+{
+    ScopedProfile(Profiler<Zones>& profiler, etl::size_t zone)
+        : _profiler{profiler}
+        , _zone{zone}
+        , _start{CycleCounter::now()}
+    {}
+
+    ~ScopedProfile() { _profiler.record(_zone, CycleCounter::now() - _start); }
+
+    ScopedProfile(ScopedProfile const&)                    = delete;
+    auto operator=(ScopedProfile const&) -> ScopedProfile& = delete;
+
+private:
+    Profiler<Zones>& _profiler;
+    etl::size_t _zone;
+    etl::uint32_t _start;
+};
+
+inline auto ProfileStats::add(etl::uint32_t cycles) -> void
+{
+    ++calls;
+    min = etl::min(min, cycles);
+    max = etl::max(max, cycles);
+    total += cycles;
+}
+
+inline auto ProfileStats::average() const -> etl::uint32_t
+{
+    if (calls == 0) {
+        return 0;
+    }
+    return static_cast<etl::uint32_t>(total / calls);
+}
+
+template<etl::size_t Zones>
+auto Profiler<Zones>::publish() -> void
+{
+    if (_ready.load(etl::memory_order_acquire)) {
+        return;
+    }
+
+    _published = _working;
+    _working   = {};
+    _ready.store(true, etl::memory_order_release);
+}
+
+template<etl::size_t Zones>
+template<typename Func>
+auto Profiler<Zones>::drain(Func func) -> bool
+{
+    if (not _ready.load(etl::memory_order_acquire)) {
+        return false;
+    }
+
+    for (auto zone = etl::size_t(0); zone < Zones; ++zone) {
+        if (_published[zone].calls > 0) {
+            func(zone, _published[zone]);
+        }
+    }
+
+    _ready.store(false, etl::memory_order_release);
+    return true;
+}
+
+}  // namespace grit
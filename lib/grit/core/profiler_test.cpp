@@ -0,0 +1,102 @@
+#include "profiler.hpp"
+
+#include <grit/core/benchmark.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <utility>
+#include <vector>
+
+TEST_CASE("core: ProfileStats")
+{
+    auto stats = grit::ProfileStats{};
+    REQUIRE(stats.calls == 0);
+    REQUIRE(stats.average() == 0);
+
+    stats.add(10);
+    stats.add(30);
+    stats.add(20);
+    REQUIRE(stats.calls == 3);
+    REQUIRE(stats.min == 10);
+    REQUIRE(stats.max == 30);
+    REQUIRE(stats.total == 60);
+    REQUIRE(stats.average() == 20);
+}
+
+TEST_CASE("core: Profiler")
+{
+    auto profiler = grit::Profiler<3>{};
+    STATIC_REQUIRE(grit::Profiler<3>::zones() == 3);
+
+    auto drained = std::vector<std::pair<etl::size_t, grit::ProfileStats>>{};
+    auto collect = [&drained](etl::size_t zone, grit::ProfileStats const& stats) { drained.emplace_back(zone, stats); };
+
+    // Nothing published yet
+    profiler.record(0, 100);
+    REQUIRE_FALSE(profiler.drain(collect));
+    REQUIRE(drained.empty());
+
+    // Only zones with calls are reported
+    profiler.record(2, 50);
+    profiler.record(2, 70);
+    profiler.publish();
+    REQUIRE(profiler.drain(collect));
+    REQUIRE(drained.size() == 2);
+    REQUIRE(drained[0].first == 0);
+    REQUIRE(drained[0].second.calls == 1);
+    REQUIRE(drained[0].second.max == 100);
+    REQUIRE(drained[1].first == 2);
+    REQUIRE(drained[1].second.calls == 2);
+    REQUIRE(drained[1].second.min == 50);
+    REQUIRE(drained[1].second.average() == 60);
+
+    // Drained once
+    drained.clear();
+    REQUIRE_FALSE(profiler.drain(collect));
+
+    // Blocks accumulate until the main loop has taken the snapshot
+    profiler.record(1, 10);
+    profiler.publish();
+    profiler.record(1, 20);
+    profiler.publish();
+    REQUIRE(profiler.drain(collect));
+    REQUIRE(drained.size() == 1);
+    REQUIRE(drained[0].second.calls == 1);
+    REQUIRE(drained[0].second.max == 10);
+
+    drained.clear();
+    profiler.record(1, 30);
+    profiler.publish();
+    REQUIRE(profiler.drain(collect));
+    REQUIRE(drained.size() == 1);
+    REQUIRE(drained[0].second.calls == 2);
+    REQUIRE(drained[0].second.min == 20);
+    REQUIRE(drained[0].second.max == 30);
+}
+
+TEST_CASE("core: ScopedProfile")
+{
+    grit::CycleCounter::enable();
+
+    auto profiler = grit::Profiler<2>{};
+    for (auto i = 0; i < 4; ++i) {
+        auto const zone = grit::ScopedProfile{profiler, 1};
+
+        auto sum = 0.0;
+        for (auto j = 0; j < 1000; ++j) {
+            sum += static_cast<double>(j);
+            grit::doNotOptimize(sum);
+        }
+    }
+    profiler.publish();
+
+    auto calls = etl::uint32_t(0);
+    auto max   = etl::uint32_t(0);
+    REQUIRE(profiler.drain([&](etl::size_t zone, grit::ProfileStats const& stats) {
+        REQUIRE(zone == 1);
+        calls = stats.calls;
+        max   = stats.max;
+    }));
+    REQUIRE(calls == 4);
+    REQUIRE(max > 0);
+}
@@ -1,7 +1,7 @@
 #include "ares.hpp"
 
 #include <etl/algorithm.hpp>
-#include <etl/functional.hpp>
+#include <etl/cmath.hpp>
 
 namespace grit {
 
@@ -24,43 +24,84 @@ auto Ares::prepare(float sampleRate, etl::size_t blockSize) -> void
 
 auto Ares::process(StereoBlock<float> const& buffer, ControlInput const& inputs) -> void
 {
-    auto const gainKnob   = _gainKnob(inputs.gainKnob);
-    auto const toneKnob   = _toneKnob(inputs.toneKnob);
-    auto const outputKnob = _outputKnob(inputs.outputKnob);
-    auto const mixKnob    = _mixKnob(inputs.mixKnob);
-
-    auto const gainCV   = _gainCV(inputs.gainCV);
-    auto const toneCV   = _toneCV(inputs.toneCV);
-    auto const outputCV = _outputCV(inputs.outputCV);
-    auto const mixCV    = _mixCV(inputs.mixCV);
-
-    auto const parameter = Channel::Parameter{
-        .mode   = inputs.mode,
-        .gain   = etl::clamp(gainKnob + gainCV, 0.0F, 1.0F),
-        .tone   = etl::clamp(toneKnob + toneCV, 0.0F, 1.0F),
-        .output = etl::clamp(outputKnob + outputCV, 0.0F, 1.0F),
-        .mix    = etl::clamp(mixKnob + mixCV, 0.0F, 1.0F),
-    };
-
-    for (auto& channel : _channels) {
-        channel.setParameter(parameter);
+    auto parameter = Channel::Parameter{};
+    {
+        auto const zone = ScopedProfile{_profiler, SmoothingZone};
+
+        auto const gainKnob   = _gainKnob(inputs.gainKnob);
+        auto const toneKnob   = _toneKnob(inputs.toneKnob);
+        auto const outputKnob = _outputKnob(inputs.outputKnob);
+        auto const mixKnob    = _mixKnob(inputs.mixKnob);
+
+        auto const gainCV   = _gainCV(inputs.gainCV);
+        auto const toneCV   = _toneCV(inputs.toneCV);
+        auto const outputCV = _outputCV(inputs.outputCV);
+        auto const mixCV    = _mixCV(inputs.mixCV);
+
+        parameter = Channel::Parameter{
+            .mode   = inputs.mode,
+            .gain   = etl::clamp(gainKnob + gainCV, 0.0F, 1.0F),
+            .tone   = etl::clamp(toneKnob + toneCV, 0.0F, 1.0F),
+            .output = etl::clamp(outputKnob + outputCV, 0.0F, 1.0F),
+            .mix    = etl::clamp(mixKnob + mixCV, 0.0F, 1.0F),
+        };
     }
 
-    for (auto i = size_t(0); i < buffer.extent(1); ++i) {
-        buffer(0, i) = etl::invoke(_channels[0], buffer(0, i));
-        buffer(1, i) = etl::invoke(_channels[1], buffer(1, i));
+    {
+        auto const zone = ScopedProfile{_profiler, ParameterZone};
+        for (auto& channel : _channels) {
+            channel.setParameter(parameter);
+        }
     }
+
+    auto left  = etl::array<float, maxChunkSize>{};
+    auto right = etl::array<float, maxChunkSize>{};
+
+    for (auto offset = size_t(0); offset < buffer.extent(1); offset += maxChunkSize) {
+        auto const size = etl::min(maxChunkSize, buffer.extent(1) - offset);
+
+        for (auto i = size_t(0); i < size; ++i) {
+            left[i]  = buffer(0, offset + i);
+            right[i] = buffer(1, offset + i);
+        }
+
+        {
+            auto const zone = ScopedProfile{_profiler, AmpZone};
+            _channels[0].process(etl::span{left}.first(size));
+            _channels[1].process(etl::span{right}.first(size));
+        }
+
+        for (auto i = size_t(0); i < size; ++i) {
+            buffer(0, offset + i) = left[i];
+            buffer(1, offset + i) = right[i];
+        }
+    }
+
+    _profiler.publish();
 }
 
 auto Ares::Channel::setParameter(Parameter const& parameter) -> void
 {
+    auto const moved = [](float current, float next) { return etl::abs(next - current) > tolerance; };
+
     if (parameter.mode != _mode) {
         _fire.reset();
         _grind.reset();
+        _dirty = true;
     }
 
     _mode = parameter.mode;
 
+    // Compared against the last applied values, so a slow drift still adds up past the tolerance.
+    auto const changed = _dirty or moved(_parameter.gain, parameter.gain) or moved(_parameter.tone, parameter.tone)
+                      or moved(_parameter.output, parameter.output) or moved(_parameter.mix, parameter.mix);
+    if (not changed) {
+        return;
+    }
+
+    _parameter = parameter;
+    _dirty     = false;
+
     if (parameter.mode == Mode::Fire) {
         _fire.setParameter(
             {.gain = parameter.gain, .tone = parameter.tone, .output = parameter.output, .mix = parameter.mix}
@@ -78,12 +119,13 @@ auto Ares::Channel::setSampleRate(float sampleRate) -> void
     _grind.setSampleRate(sampleRate);
 }
 
-auto Ares::Channel::operator()(float sample) -> float
+auto Ares::Channel::process(etl::span<float> buffer) -> void
 {
     if (_mode == Mode::Fire) {
-        return _fire(sample);
+        _fire.process(buffer, buffer);
+    } else {
+        _grind.process(buffer, buffer);
     }
-    return _grind(sample);
 }
 
 }  // namespace grit
@@ -4,9 +4,11 @@
 #include <grit/audio/airwindows/airwindows_grind_amp.hpp>
 #include <grit/audio/filter/dynamic_smoothing.hpp>
 #include <grit/audio/stereo/stereo_block.hpp>
+#include <grit/core/profiler.hpp>
 
 #include <etl/array.hpp>
 #include <etl/cstdint.hpp>
+#include <etl/span.hpp>
 
 namespace grit {
 
@@ -34,12 +36,31 @@ struct Ares
         float mixCV{0};
     };
 
+    enum ProfileZone : etl::uint8_t
+    {
+        SmoothingZone = 0,
+        ParameterZone,
+        AmpZone,
+        MaxZone,
+    };
+
+    static constexpr auto profileZoneNames = etl::array<char const*, MaxZone>{
+        "smoothing",
+        "parameter",
+        "amp",
+    };
+
     Ares() = default;
 
     auto prepare(float sampleRate, etl::size_t blockSize) -> void;
     auto process(StereoBlock<float> const& buffer, ControlInput const& inputs) -> void;
 
+    /// Cycles per stage, summed over both channels. Published once per block.
+    [[nodiscard]] auto profiler() -> Profiler<MaxZone>& { return _profiler; }
+
 private:
+    static constexpr auto maxChunkSize = etl::size_t(32);
+
     struct Channel
     {
         struct Parameter
@@ -56,9 +77,14 @@ private:
         auto setParameter(Parameter const& parameter) -> void;
         auto setSampleRate(float sampleRate) -> void;
 
-        [[nodiscard]] auto operator()(float sample) -> float;
+        auto process(etl::span<float> buffer) -> void;
 
     private:
+        // Control movement below this is ADC jitter & doesn't recompute coefficients.
+        static constexpr auto tolerance = 1e-4F;
+
+        Parameter _parameter{};
+        bool _dirty{true};
         Mode _mode{Mode::Fire};
 
         AirWindowsFireAmp<float> _fire;
@@ -75,6 +101,7 @@ private:
     DynamicSmoothing<float> _mixCV;
 
     etl::array<Channel, 2> _channels{};
+    Profiler<MaxZone> _profiler{};
 };
 
 }  // namespace grit
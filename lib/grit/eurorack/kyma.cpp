@@ -4,10 +4,56 @@
 #include <grit/math/remap.hpp>
 #include <grit/unit/decibel.hpp>
 
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/numbers.hpp>
+
 namespace grit {
 
+namespace {
+
+// Sine, triangle, sawtooth & square in phase with each other, so the morph
+// doesn't cancel. The shapes are naive, the mipmaps band-limit them. Jumps
+// are sampled at their midpoint.
+[[nodiscard]] auto frameShape(etl::size_t frame, float phase) -> float
+{
+    switch (frame) {
+        case 0: {
+            return etl::sin(phase * 2.0F * static_cast<float>(etl::numbers::pi));
+        }
+        case 1: {
+            if (phase < 0.25F) {
+                return phase * 4.0F;
+            }
+            return phase < 0.75F ? 2.0F - phase * 4.0F : phase * 4.0F - 4.0F;
+        }
+        case 2: {
+            if (phase == 0.5F) {
+                return 0.0F;
+            }
+            return phase < 0.5F ? phase * 2.0F : phase * 2.0F - 2.0F;
+        }
+        default: {
+            if (phase == 0.0F or phase == 0.5F) {
+                return 0.0F;
+            }
+            return phase < 0.5F ? 1.0F : -1.0F;
+        }
+    }
+}
+
+}  // namespace
+
 auto Kyma::prepare(float sampleRate, etl::size_t blockSize) -> void
 {
+    auto waveform = etl::array<float, tableSize>{};
+    for (auto frame = etl::size_t(0); frame < numFrames; ++frame) {
+        for (auto i = etl::size_t(0); i < tableSize; ++i) {
+            waveform[i] = frameShape(frame, static_cast<float>(i) / static_cast<float>(tableSize));
+        }
+        _frames[frame].setWaveform(waveform);
+    }
+
     _sampleRate = sampleRate;
     _adsr.setSampleRate(sampleRate);
     _oscillator.setSampleRate(sampleRate);
@@ -26,61 +72,77 @@ auto Kyma::prepare(float sampleRate, etl::size_t blockSize) -> void
 
 auto Kyma::process(StereoBlock<float> const& buffer, ControlInput const& inputs) -> float
 {
-    auto const pitchKnob   = _pitchKnob(inputs.pitchKnob);
-    auto const attackKnob  = _morphKnob(inputs.morphKnob);
-    auto const morphKnob   = _attackKnob(inputs.attackKnob);
-    auto const releaseKnob = _releaseKnob(inputs.releaseKnob);
-
-    auto const vOctCv     = _vOctCV(inputs.vOctCV);
-    auto const morphCv    = _morphCV(inputs.morphCV);
-    auto const subGainCv  = _subGainCV(inputs.subGainCV);
-    auto const subMorphCv = _subMorphCV(inputs.subMorphCV);
-
-    auto const pitch          = grit::remap(pitchKnob, 36.0F, 96.0F);
-    auto const voltsPerOctave = grit::remap(vOctCv, 0.0F, 60.0F);
-    auto const note           = etl::clamp(pitch + voltsPerOctave, 0.0F, 127.0F);
-    auto const morph          = etl::clamp(morphKnob + morphCv, 0.0F, 1.0F);
-
-    auto const subOffset     = inputs.subShift ? 12.0F : 24.0F;
-    auto const subNoteNumber = etl::clamp(note - subOffset, 0.0F, 127.0F);
-    auto const subMorph      = etl::clamp(subMorphCv, 0.0F, 1.0F);
-    auto const subGain       = grit::remap(subGainCv, 0.0F, 1.0F);
-
-    auto const attack  = grit::remap(attackKnob, 0.0F, 0.750F);
-    auto const release = grit::remap(releaseKnob, 0.0F, 2.5F);
-
-    _adsr.gate(inputs.gate);
-    _adsr.setParameter({
-        .attack  = grit::Seconds<float>{attack},
-        .decay   = grit::Seconds<float>{0.0F},
-        .sustain = 1.0F,
-        .release = grit::Seconds<float>{release},
-    });
-
-    // oscillator.setWavetable(SineWavetable);
-    // subOscillator.setWavetable(SineWavetable);
-    // oscillator.setShapeMorph(morph);
-    // subOscillator.setShapeMorph(subMorph);
-    etl::ignore_unused(subMorph, morph);
-
-    _oscillator.setFrequency(grit::noteToHertz(note));
-    _subOscillator.setFrequency(grit::noteToHertz(subNoteNumber));
+    auto note          = 0.0F;
+    auto morph         = 0.0F;
+    auto subNoteNumber = 0.0F;
+    auto subMorph      = 0.0F;
+    auto subGain       = 0.0F;
+    auto attack        = 0.0F;
+    auto release       = 0.0F;
+    {
+        auto const zone = ScopedProfile{_profiler, SmoothingZone};
+
+        auto const pitchKnob   = _pitchKnob(inputs.pitchKnob);
+        auto const morphKnob   = _morphKnob(inputs.morphKnob);
+        auto const attackKnob  = _attackKnob(inputs.attackKnob);
+        auto const releaseKnob = _releaseKnob(inputs.releaseKnob);
+
+        auto const vOctCv     = _vOctCV(inputs.vOctCV);
+        auto const morphCv    = _morphCV(inputs.morphCV);
+        auto const subGainCv  = _subGainCV(inputs.subGainCV);
+        auto const subMorphCv = _subMorphCV(inputs.subMorphCV);
+
+        auto const pitch          = grit::remap(pitchKnob, 36.0F, 96.0F);
+        auto const voltsPerOctave = grit::remap(vOctCv, 0.0F, 60.0F);
+        note                      = etl::clamp(pitch + voltsPerOctave, 0.0F, 127.0F);
+        morph                     = etl::clamp(morphKnob + morphCv, 0.0F, 1.0F);
+
+        auto const subOffset = inputs.subShift ? 12.0F : 24.0F;
+        subNoteNumber        = etl::clamp(note - subOffset, 0.0F, 127.0F);
+        subMorph             = etl::clamp(subMorphCv, 0.0F, 1.0F);
+        subGain              = grit::remap(subGainCv, 0.0F, 1.0F);
+
+        attack  = grit::remap(attackKnob, 0.0F, 0.750F);
+        release = grit::remap(releaseKnob, 0.0F, 2.5F);
+    }
+
+    {
+        auto const zone = ScopedProfile{_profiler, ParameterZone};
+
+        _adsr.gate(inputs.gate);
+        _adsr.setParameter({
+            .attack  = grit::Seconds<float>{attack},
+            .decay   = grit::Seconds<float>{0.0F},
+            .sustain = 1.0F,
+            .release = grit::Seconds<float>{release},
+        });
+
+        _oscillator.setShapeMorph(morph);
+        _subOscillator.setShapeMorph(subMorph);
+        _oscillator.setFrequency(grit::noteToHertz(note));
+        _subOscillator.setFrequency(grit::noteToHertz(subNoteNumber));
+    }
 
     auto env = 0.0F;
 
-    for (size_t i = 0; i < buffer.extent(1); ++i) {
-        auto const fmModulator = buffer(0, i);
-        auto const fmAmount    = buffer(1, i);
-        _oscillator.addPhaseOffset(fmModulator * fmAmount);
-        env = _adsr();
+    {
+        auto const zone = ScopedProfile{_profiler, OscillatorZone};
+
+        for (size_t i = 0; i < buffer.extent(1); ++i) {
+            auto const fmModulator = buffer(0, i);
+            auto const fmAmount    = buffer(1, i);
+            _oscillator.addPhaseOffset(fmModulator * fmAmount);
+            env = _adsr();
 
-        auto const osc = _oscillator() * env;
-        auto const sub = _subOscillator() * env * subGain;
+            auto const osc = _oscillator() * env;
+            auto const sub = _subOscillator() * env * subGain;
 
-        buffer(0, i) = sub * 0.75F;
-        buffer(1, i) = osc * 0.75F;
+            buffer(0, i) = sub * 0.75F;
+            buffer(1, i) = osc * 0.75F;
+        }
     }
 
+    _profiler.publish();
     return env;
 }
 
@@ -2,9 +2,13 @@
 
 #include <grit/audio/envelope/envelope_adsr.hpp>
 #include <grit/audio/filter/dynamic_smoothing.hpp>
-#include <grit/audio/oscillator/variable_shape_oscillator.hpp>
-#include <grit/audio/oscillator/wavetable_oscillator.hpp>
+#include <grit/audio/oscillator/mipmapped_morphing_wavetable_oscillator.hpp>
+#include <grit/audio/oscillator/mipmapped_wavetable.hpp>
 #include <grit/audio/stereo/stereo_block.hpp>
+#include <grit/core/profiler.hpp>
+
+#include <etl/array.hpp>
+#include <etl/cstdint.hpp>
 
 namespace grit {
 
@@ -27,14 +31,41 @@ struct Kyma
         bool subShift{false};
     };
 
+    enum ProfileZone : etl::uint8_t
+    {
+        SmoothingZone = 0,
+        ParameterZone,
+        OscillatorZone,
+        MaxZone,
+    };
+
+    static constexpr auto profileZoneNames = etl::array<char const*, MaxZone>{
+        "smoothing",
+        "parameter",
+        "oscillator",
+    };
+
     Kyma() = default;
 
+    // The oscillators point into the frames of this instance.
+    Kyma(Kyma const&)                    = delete;
+    auto operator=(Kyma const&) -> Kyma& = delete;
+
     auto prepare(float sampleRate, etl::size_t blockSize) -> void;
     auto process(StereoBlock<float> const& buffer, ControlInput const& inputs) -> float;
 
+    /// Cycles per stage. Published once per block.
+    [[nodiscard]] auto profiler() -> Profiler<MaxZone>& { return _profiler; }
+
 private:
-    static constexpr auto sine      = makeSineWavetable<float, 2048>();
-    static constexpr auto wavetable = etl::mdspan{sine.data(), etl::extents<etl::size_t, sine.size()>{}};
+    static constexpr auto tableSize = etl::size_t(1024);
+    static constexpr auto numFrames = etl::size_t(4);
+
+    // The top level keeps two harmonics, enough for note 127 at 96 kHz.
+    static constexpr auto numLevels = etl::size_t(9);
+
+    using Wavetable  = MipmappedWavetable<float, tableSize, numLevels>;
+    using Oscillator = MipmappedMorphingWavetableOscillator<float, numFrames, tableSize, numLevels>;
 
     float _sampleRate{};
 
@@ -48,8 +79,13 @@ private:
     DynamicSmoothing<float> _subMorphCV;
 
     EnvelopeADSR<float> _adsr;
-    WavetableOscillator<float, sine.size()> _oscillator{wavetable};
-    WavetableOscillator<float, sine.size()> _subOscillator{wavetable};
+
+    // Sine, triangle, sawtooth & square, morphed in that order. Built in prepare().
+    etl::array<Wavetable, numFrames> _frames{};
+    Oscillator _oscillator{_frames};
+    Oscillator _subOscillator{_frames};
+
+    Profiler<MaxZone> _profiler{};
 };
 
 }  // namespace grit
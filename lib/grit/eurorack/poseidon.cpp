@@ -1,5 +1,7 @@
 #include "poseidon.hpp"
 
+#include <etl/cmath.hpp>
+
 namespace grit {
 
 auto Poseidon::nextTextureAlgorithm() -> void {}
@@ -30,40 +32,61 @@ auto Poseidon::prepare(float sampleRate, etl::size_t blockSize) -> void
 
 auto Poseidon::process(StereoBlock<float> const& buffer, ControlInput const& inputs) -> ControlOutput
 {
-    auto const textureKnob    = _textureKnob(inputs.textureKnob);
-    auto const morphKnob      = _morphKnob(inputs.morphKnob);
-    auto const ampKnob        = _ampKnob(inputs.ampKnob);
-    auto const compressorKnob = _compressorKnob(inputs.compressorKnob);
-    auto const morphCv        = _morphCv(inputs.morphCV);
-    auto const sideChainCv    = _sideChainCv(inputs.sideChainCV);
-    auto const attackCv       = _attackCv(inputs.attackCV);
-    auto const releaseCv      = _releaseCv(inputs.releaseCV);
-
-    auto const channelParameter = Poseidon::Channel::Parameter{
-        .texture    = textureKnob,
-        .morph      = etl::clamp(morphKnob + morphCv, 0.0F, 1.0F),
-        .amp        = ampKnob,
-        .compressor = compressorKnob,
-        .sideChain  = sideChainCv,
-        .attack     = attackCv,
-        .release    = releaseCv,
-    };
-
-    for (auto& channel : _channels) {
-        channel.setParameter(channelParameter);
+    auto channelParameter = Poseidon::Channel::Parameter{};
+    {
+        auto const zone = ScopedProfile{_profiler, SmoothingZone};
+
+        auto const textureKnob    = _textureKnob(inputs.textureKnob);
+        auto const morphKnob      = _morphKnob(inputs.morphKnob);
+        auto const ampKnob        = _ampKnob(inputs.ampKnob);
+        auto const compressorKnob = _compressorKnob(inputs.compressorKnob);
+        auto const morphCv        = _morphCv(inputs.morphCV);
+        auto const sideChainCv    = _sideChainCv(inputs.sideChainCV);
+        auto const attackCv       = _attackCv(inputs.attackCV);
+        auto const releaseCv      = _releaseCv(inputs.releaseCV);
+
+        channelParameter = Poseidon::Channel::Parameter{
+            .texture    = textureKnob,
+            .morph      = etl::clamp(morphKnob + morphCv, 0.0F, 1.0F),
+            .amp        = ampKnob,
+            .compressor = compressorKnob,
+            .sideChain  = sideChainCv,
+            .attack     = attackCv,
+            .release    = releaseCv,
+        };
     }
 
-    auto env = 0.0F;
-    for (auto i = size_t(0); i < buffer.extent(1); ++i) {
-        auto const [left, envLeft]   = etl::invoke(_channels[0], buffer(0, i));
-        auto const [right, envRight] = etl::invoke(_channels[1], buffer(1, i));
+    {
+        auto const zone = ScopedProfile{_profiler, ParameterZone};
+        for (auto& channel : _channels) {
+            channel.setParameter(channelParameter);
+        }
+    }
 
-        env = (envLeft + envRight) * 0.5F;
+    auto left  = etl::array<float, maxChunkSize>{};
+    auto right = etl::array<float, maxChunkSize>{};
 
-        buffer(0, i) = left;
-        buffer(1, i) = right;
+    auto env = 0.0F;
+    for (auto offset = size_t(0); offset < buffer.extent(1); offset += maxChunkSize) {
+        auto const size = etl::min(maxChunkSize, buffer.extent(1) - offset);
+
+        for (auto i = size_t(0); i < size; ++i) {
+            left[i]  = buffer(0, offset + i);
+            right[i] = buffer(1, offset + i);
+        }
+
+        auto const envLeft  = _channels[0].process(etl::span{left}.first(size), _profiler);
+        auto const envRight = _channels[1].process(etl::span{right}.first(size), _profiler);
+        env                 = (envLeft + envRight) * 0.5F;
+
+        for (auto i = size_t(0); i < size; ++i) {
+            buffer(0, offset + i) = left[i];
+            buffer(1, offset + i) = right[i];
+        }
     }
 
+    _profiler.publish();
+
     // "DIGITAL" GATE LOGIC
     auto const gateOut = inputs.gate1 != inputs.gate2;
 
@@ -84,28 +107,48 @@ auto Poseidon::Amp::next() -> void
 
 auto Poseidon::Amp::setSampleRate(float sampleRate) -> void
 {
+    _hard.setSampleRate(sampleRate);
+    _fullWave.setSampleRate(sampleRate);
+    _halfWave.setSampleRate(sampleRate);
+    _diode.setSampleRate(sampleRate);
     _fireAmp.setSampleRate(sampleRate);
     _grindAmp.setSampleRate(sampleRate);
 }
 
-auto Poseidon::Amp::operator()(float sample) -> float
+auto Poseidon::Amp::process(etl::span<float> buffer) -> void
 {
     switch (_index) {
-        case TanhIndex: return _tanh(sample);
-        case HardIndex: return _hard(sample);
-        case FullWaveIndex: return _fullWave(sample);
-        case HalfWaveIndex: return _halfWave(sample);
-        case DiodeIndex: return _diode(sample);
-        case FireAmpIndex: return _fireAmp(sample);
-        case GrindAmpIndex: return _grindAmp(sample);
+        case TanhIndex: _tanh.process(buffer, buffer); break;
+        case HardIndex: _hard.process(buffer, buffer); break;
+        case FullWaveIndex: _fullWave.process(buffer, buffer); break;
+        case HalfWaveIndex: _halfWave.process(buffer, buffer); break;
+        case DiodeIndex: _diode.process(buffer, buffer); break;
+        case FireAmpIndex: _fireAmp.process(buffer, buffer); break;
+        case GrindAmpIndex: _grindAmp.process(buffer, buffer); break;
         default: break;
     }
-    return sample;
 }
 
 auto Poseidon::Channel::setParameter(Parameter const& parameter) -> void
 {
+    auto const moved = [](float current, float next) { return etl::abs(next - current) > tolerance; };
+
+    // Read per sample, always follow the controls.
+    _parameter.texture   = parameter.texture;
+    _parameter.morph     = parameter.morph;
+    _parameter.amp       = parameter.amp;
+    _parameter.sideChain = parameter.sideChain;
+
+    // The envelope & compressor keep the last applied values, so a slow
+    // drift still adds up past the tolerance.
+    auto const changed = _dirty or moved(_parameter.compressor, parameter.compressor)
+                      or moved(_parameter.attack, parameter.attack) or moved(_parameter.release, parameter.release);
+    if (not changed) {
+        return;
+    }
+
     _parameter = parameter;
+    _dirty     = false;
 
     auto const attack  = Milliseconds<float>{attackRange.from0to1(parameter.attack)};
     auto const release = Milliseconds<float>{releaseRange.from0to1(parameter.release)};
@@ -133,21 +176,40 @@ auto Poseidon::Channel::setSampleRate(float sampleRate) -> void
     _distortion.setSampleRate(sampleRate);
 }
 
-auto Poseidon::Channel::operator()(float sample) -> etl::pair<float, float>
+auto Poseidon::Channel::process(etl::span<float> buffer, Profiler<MaxZone>& profiler) -> float
 {
-    auto const env     = _envelope(sample);
-    auto const texture = etl::clamp(env + _parameter.texture, 0.0F, 1.0F);
+    auto envelope = etl::array<float, maxChunkSize>{};
+    auto env      = etl::span{envelope}.first(buffer.size());
+
+    {
+        auto const zone = ScopedProfile{profiler, EnvelopeZone};
+        _envelope.process(buffer, env);
+
+        // _vinyl.setDeRez(texture);
+        // auto const vinyl = _vinyl(sample);
+
+        auto const drive = remap(_parameter.amp, 1.0F, 8.0F);  // +18dB
+        for (auto i = size_t(0); i < buffer.size(); ++i) {
+            auto const texture = etl::clamp(env[i] + _parameter.texture, 0.0F, 1.0F);
+            auto const noise   = _whiteNoise() * 0.05F * _parameter.morph * texture;
+            // auto const mix   = ;
+            // auto const mixed = (noise * mix) + (vinyl * (1.0F - mix));
 
-    // _vinyl.setDeRez(texture);
-    // auto const vinyl = _vinyl(sample);
+            buffer[i] = (buffer[i] + noise) * drive;
+        }
+    }
+
+    {
+        auto const zone = ScopedProfile{profiler, DistortionZone};
+        _distortion.process(buffer);
+    }
 
-    auto const noise = _whiteNoise() * 0.05F * _parameter.morph * texture;
-    // auto const mix   = ;
-    // auto const mixed = (noise * mix) + (vinyl * (1.0F - mix));
+    {
+        auto const zone = ScopedProfile{profiler, CompressorZone};
+        _compressor.process(buffer, buffer);
+    }
 
-    auto const drive   = remap(_parameter.amp, 1.0F, 8.0F);  // +18dB
-    auto const distOut = _distortion((sample + noise) * drive);
-    return {_compressor(distOut, distOut), env};
+    return env.empty() ? 0.0F : env.back();
 }
 
 }  // namespace grit
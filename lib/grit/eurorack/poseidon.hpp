@@ -8,12 +8,14 @@
 #include <grit/audio/filter/dynamic_smoothing.hpp>
 #include <grit/audio/mix/cross_fade.hpp>
 #include <grit/audio/noise/white_noise.hpp>
+#include <grit/audio/oversampling/oversampled.hpp>
 #include <grit/audio/stereo/stereo_block.hpp>
 #include <grit/audio/waveshape/diode_rectifier.hpp>
 #include <grit/audio/waveshape/full_wave_rectifier.hpp>
 #include <grit/audio/waveshape/half_wave_rectifier.hpp>
 #include <grit/audio/waveshape/hard_clipper.hpp>
 #include <grit/audio/waveshape/tanh_clipper.hpp>
+#include <grit/core/profiler.hpp>
 #include <grit/math/normalizable_range.hpp>
 #include <grit/math/remap.hpp>
 #include <grit/unit/decibel.hpp>
@@ -21,7 +23,7 @@
 #include <etl/algorithm.hpp>
 #include <etl/array.hpp>
 #include <etl/cstdint.hpp>
-#include <etl/functional.hpp>
+#include <etl/span.hpp>
 #include <etl/utility.hpp>
 #include <etl/variant.hpp>
 
@@ -52,6 +54,24 @@ struct Poseidon
         bool gate2{false};
     };
 
+    enum ProfileZone : etl::uint8_t
+    {
+        SmoothingZone = 0,
+        ParameterZone,
+        EnvelopeZone,
+        DistortionZone,
+        CompressorZone,
+        MaxZone,
+    };
+
+    static constexpr auto profileZoneNames = etl::array<char const*, MaxZone>{
+        "smoothing",
+        "parameter",
+        "envelope",
+        "distortion",
+        "compressor",
+    };
+
     Poseidon() = default;
 
     auto nextTextureAlgorithm() -> void;
@@ -60,14 +80,21 @@ struct Poseidon
     auto prepare(float sampleRate, etl::size_t blockSize) -> void;
     [[nodiscard]] auto process(StereoBlock<float> const& buffer, ControlInput const& inputs) -> ControlOutput;
 
+    /// Cycles per stage, published once per block. The envelope, distortion & compressor
+    /// zones are recorded for each channel on each chunk, so their statistics are per
+    /// channel & chunk, with calls counting both channels.
+    [[nodiscard]] auto profiler() -> Profiler<MaxZone>& { return _profiler; }
+
 private:
+    static constexpr auto maxChunkSize = etl::size_t(32);
+
     struct Amp
     {
         Amp() = default;
 
         auto next() -> void;
         auto setSampleRate(float sampleRate) -> void;
-        [[nodiscard]] auto operator()(float sample) -> float;
+        auto process(etl::span<float> buffer) -> void;
 
     private:
         enum Index : etl::int8_t
@@ -83,11 +110,11 @@ private:
         };
 
         Index _index{TanhIndex};
-        TanhClipperADAA1<float> _tanh;
-        HardClipper<float> _hard{};
-        FullWaveRectifier<float> _fullWave{};
-        HalfWaveRectifier<float> _halfWave{};
-        DiodeRectifier<float> _diode{};
+        TanhClipperADAA2<float> _tanh;
+        Oversampled<HardClipper<float>, 2> _hard{};
+        Oversampled<FullWaveRectifier<float>, 2> _fullWave{};
+        Oversampled<HalfWaveRectifier<float>, 2> _halfWave{};
+        Oversampled<DiodeRectifier<float>, 2> _diode{};
         AirWindowsFireAmp<float> _fireAmp{42};
         AirWindowsGrindAmp<float> _grindAmp{143};
     };
@@ -111,19 +138,26 @@ private:
         auto nextDistortionAlgorithm() -> void;
 
         auto setSampleRate(float sampleRate) -> void;
-        [[nodiscard]] auto operator()(float sample) -> etl::pair<float, float>;
+
+        /// Processes the buffer in-place, returns the last envelope value.
+        /// \pre buffer.size() <= maxChunkSize
+        [[nodiscard]] auto process(etl::span<float> buffer, Profiler<MaxZone>& profiler) -> float;
 
     private:
         static constexpr auto attackRange  = NormalizableRange<float>{1.0F, 100.0F, 25.0F};
         static constexpr auto releaseRange = NormalizableRange<float>{1.0F, 500.0F, 100.0F};
 
+        // Control movement below this is ADC jitter & doesn't recompute coefficients.
+        static constexpr auto tolerance = 1e-4F;
+
         Parameter _parameter{};
+        bool _dirty{true};
 
         EnvelopeFollower<float> _envelope;
         WhiteNoise<float> _whiteNoise;
         AirWindowsVinylDither<float> _vinyl;
         Amp _distortion;
-        SoftKneeCompressor<float> _compressor;
+        LogDomainSoftKneeCompressor<float> _compressor;
     };
 
     DynamicSmoothing<float> _textureKnob;
@@ -136,6 +170,7 @@ private:
     DynamicSmoothing<float> _releaseCv;
 
     etl::array<Channel, 2> _channels{};
+    Profiler<MaxZone> _profiler{};
 };
 
 }  // namespace grit
@@ -93,6 +93,25 @@ TEST_CASE("eurorack: Kyma")
             }
         }
     }
+
+    SECTION("attack follows the attack knob, not the morph knob")
+    {
+        auto const envelopeAfter100ms = [&](float attackKnob, float morphKnob, bool gate) {
+            auto buffer = etl::array<float, static_cast<size_t>(2 * blockSize)>{};
+            auto block  = grit::StereoBlock<float>{buffer.data(), blockSize};
+            auto env    = 0.0F;
+            for (auto i{0}; i < static_cast<int>(sampleRate * 0.1F) / blockSize; ++i) {
+                env = ares.process(block, {.morphKnob = morphKnob, .attackKnob = attackKnob, .gate = gate});
+            }
+            return env;
+        };
+
+        // Let the knob smoothers settle before each gate.
+        REQUIRE(envelopeAfter100ms(1.0F, 0.0F, false) < 0.01F);
+        REQUIRE(envelopeAfter100ms(1.0F, 0.0F, true) < 0.5F);
+        REQUIRE(envelopeAfter100ms(0.0F, 1.0F, false) < 0.01F);
+        REQUIRE(envelopeAfter100ms(0.0F, 1.0F, true) > 0.9F);
+    }
 }
 
 TEST_CASE("eurorack: Poseidon")
@@ -169,4 +188,14 @@ TEST_CASE("eurorack: Poseidon")
             REQUIRE(etl::isfinite(block(1, i)));
         }
     }
+
+    // Every stage reported, the per channel stages twice per block
+    auto zones = 0;
+    REQUIRE(poseidon.profiler().drain([&zones](etl::size_t zone, grit::ProfileStats const& stats) {
+        auto const perBlock = zone == grit::Poseidon::SmoothingZone or zone == grit::Poseidon::ParameterZone ? 1U : 2U;
+        REQUIRE(stats.calls % perBlock == 0);
+        REQUIRE(stats.calls > 0);
+        ++zones;
+    }));
+    REQUIRE(zones == grit::Poseidon::MaxZone);
 }
@@ -2,6 +2,9 @@
 
 /// \defgroup grit-fft FFT
 
+#include <grit/fft/bit_reversed_plan.hpp>
 #include <grit/fft/bitrevorder.hpp>
 #include <grit/fft/direction.hpp>
 #include <grit/fft/fft.hpp>
+#include <grit/fft/fixed_point_plan.hpp>
+#include <grit/fft/real_plan.hpp>
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <grit/fft/bitrevorder.hpp>
+#include <grit/fft/direction.hpp>
+#include <grit/fft/fft.hpp>
+
+#include <etl/complex.hpp>
+#include <etl/concepts.hpp>
+#include <etl/cstddef.hpp>
+#include <etl/linalg.hpp>
+
+namespace grit::fft {
+
+/// \brief Complex fft without the bit-reversal pass.
+///
+/// \details The forward transform is a decimation-in-frequency fft which
+/// takes natural order input and leaves the spectrum in bit-reversed order.
+/// The backward transform runs Kernel (decimation-in-time) directly on that
+/// bit-reversed spectrum and returns natural order output. Use it when the
+/// bin order doesn't matter, e.g. fast convolution via multiply(), and
+/// BitrevorderPlan::index() to find a specific bin.
+///
+/// Like ComplexPlan, the backward transform is unnormalized.
+///
+/// \ingroup grit-fft
+template<typename Complex, etl::size_t Size, typename Kernel = Radix2Kernel>
+struct ComplexPlanBitReversed
+{
+    using ValueType = Complex;
+    using SizeType  = etl::size_t;
+
+    constexpr ComplexPlanBitReversed() = default;
+
+    [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
+
+    [[nodiscard]] static constexpr auto order() -> etl::size_t { return ilog2(Size); }
+
+    /// Bin k of the natural order spectrum is at binIndex(k) of the output
+    [[nodiscard]] static constexpr auto binIndex(etl::size_t k) -> etl::size_t
+    {
+        return BitrevorderPlan<Size>::index(k);
+    }
+
+    template<etl::linalg::inout_vector InOutVec>
+        requires etl::same_as<typename InOutVec::value_type, Complex>
+    auto operator()(InOutVec x, Direction dir) -> void
+    {
+        auto const w = detail::twiddleView<Complex, size()>();
+
+        if (dir == Direction::Forward) {
+            detail::ComplexDif2Stage<Complex, order(), 0>{}(x, w);
+        } else {
+            Kernel::template transform<size()>(x, etl::linalg::conjugated(w));
+        }
+    }
+};
+
+/// \brief out = a * b, element-wise.
+/// \details Spectra only need to share the same bin order, so this works on
+/// natural & bit-reversed spectra alike. out may alias a or b.
+/// \ingroup grit-fft
+template<etl::linalg::in_vector InVecA, etl::linalg::in_vector InVecB, etl::linalg::out_vector OutVec>
+auto multiply(InVecA a, InVecB b, OutVec out) -> void
+{
+    for (auto i = typename OutVec::index_type(0); i < out.extent(0); ++i) {
+        out(i) = a(i) * b(i);
+    }
+}
+
+/// \brief out += a * b, element-wise.
+/// \details Same order requirements as multiply().
+/// \ingroup grit-fft
+template<etl::linalg::in_vector InVecA, etl::linalg::in_vector InVecB, etl::linalg::inout_vector InOutVec>
+auto multiplyAccumulate(InVecA a, InVecB b, InOutVec out) -> void
+{
+    for (auto i = typename InOutVec::index_type(0); i < out.extent(0); ++i) {
+        out(i) += a(i) * b(i);
+    }
+}
+
+}  // namespace grit::fft
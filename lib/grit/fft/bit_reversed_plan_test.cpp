@@ -0,0 +1,101 @@
+#include "bit_reversed_plan.hpp"
+
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+namespace {
+
+template<typename Complex, etl::size_t Size, typename Kernel>
+auto testBitReversedPlan() -> void
+{
+    using Float = typename Complex::value_type;
+    using Plan  = grit::fft::ComplexPlanBitReversed<Complex, Size, Kernel>;
+
+    auto const tolerance = etl::same_as<Float, float> ? 1e-3 : 1e-9;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(1)};
+
+    auto input = etl::array<Complex, Size>{};
+    etl::generate(input.begin(), input.end(), [&] { return Complex{dist(rng), dist(rng)}; });
+
+    auto expected  = input;
+    auto reference = grit::fft::ComplexPlan<Complex, Size>{};
+    reference(etl::mdspan{expected.data(), etl::extents{Size}}, grit::fft::Direction::Forward);
+
+    auto actual = input;
+    auto x      = etl::mdspan{actual.data(), etl::extents{Size}};
+    auto plan   = Plan{};
+    plan(x, grit::fft::Direction::Forward);
+
+    for (auto k = etl::size_t(0); k < Size; ++k) {
+        CAPTURE(k);
+        auto const bin = actual[Plan::binIndex(k)];
+        REQUIRE_THAT(bin.real(), Catch::Matchers::WithinAbs(expected[k].real(), tolerance));
+        REQUIRE_THAT(bin.imag(), Catch::Matchers::WithinAbs(expected[k].imag(), tolerance));
+    }
+
+    plan(x, grit::fft::Direction::Backward);
+    for (auto i = etl::size_t(0); i < Size; ++i) {
+        CAPTURE(i);
+        REQUIRE_THAT(actual[i].real() / Float(Size), Catch::Matchers::WithinAbs(input[i].real(), tolerance));
+        REQUIRE_THAT(actual[i].imag() / Float(Size), Catch::Matchers::WithinAbs(input[i].imag(), tolerance));
+    }
+}
+
+template<typename Complex, etl::size_t Size>
+auto testCircularConvolution() -> void
+{
+    using Float = typename Complex::value_type;
+
+    auto const tolerance = etl::same_as<Float, float> ? 1e-3 : 1e-9;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(1)};
+
+    auto signal  = etl::array<Complex, Size>{};
+    auto impulse = etl::array<Complex, Size>{};
+    etl::generate(signal.begin(), signal.end(), [&] { return Complex{dist(rng), Float(0)}; });
+    etl::generate(impulse.begin(), impulse.begin() + Size / 4, [&] { return Complex{dist(rng), Float(0)}; });
+
+    auto expected = etl::array<Complex, Size>{};
+    for (auto n = etl::size_t(0); n < Size; ++n) {
+        for (auto m = etl::size_t(0); m < Size; ++m) {
+            expected[n] += signal[m] * impulse[(n + Size - m) % Size];
+        }
+    }
+
+    auto x = etl::mdspan{signal.data(), etl::extents{Size}};
+    auto h = etl::mdspan{impulse.data(), etl::extents{Size}};
+
+    auto plan = grit::fft::ComplexPlanBitReversed<Complex, Size>{};
+    plan(x, grit::fft::Direction::Forward);
+    plan(h, grit::fft::Direction::Forward);
+    grit::fft::multiply(x, h, x);
+    plan(x, grit::fft::Direction::Backward);
+
+    for (auto i = etl::size_t(0); i < Size; ++i) {
+        CAPTURE(i);
+        REQUIRE_THAT(signal[i].real() / Float(Size), Catch::Matchers::WithinAbs(expected[i].real(), tolerance));
+        REQUIRE_THAT(signal[i].imag() / Float(Size), Catch::Matchers::WithinAbs(expected[i].imag(), tolerance));
+    }
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("fft: ComplexPlanBitReversed", "", etl::complex<float>, etl::complex<double>)
+{
+    testBitReversedPlan<TestType, 2, grit::fft::Radix2Kernel>();
+    testBitReversedPlan<TestType, 4, grit::fft::Radix2Kernel>();
+    testBitReversedPlan<TestType, 64, grit::fft::Radix2Kernel>();
+    testBitReversedPlan<TestType, 128, grit::fft::Radix2Kernel>();
+    testBitReversedPlan<TestType, 1024, grit::fft::Radix2Kernel>();
+    testBitReversedPlan<TestType, 128, grit::fft::Radix4Kernel>();
+    testBitReversedPlan<TestType, 256, grit::fft::SplitRadixKernel>();
+
+    testCircularConvolution<TestType, 16>();
+    testCircularConvolution<TestType, 256>();
+}
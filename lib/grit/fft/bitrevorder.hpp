@@ -17,10 +17,13 @@ template<etl::size_t Size>
     requires(etl::has_single_bit(Size))
 struct BitrevorderPlan
 {
-    BitrevorderPlan() = default;
+    constexpr BitrevorderPlan() = default;
+
+    /// Position of natural order index i in a bit-reversed buffer and vice versa.
+    [[nodiscard]] static constexpr auto index(etl::size_t i) -> etl::size_t { return _table[i]; }
 
     template<etl::linalg::inout_vector Vec>
-    auto operator()(Vec x) -> void
+    auto operator()(Vec x) const -> void
     {
         for (auto i{0U}; i < _table.size(); ++i) {
             auto const j = static_cast<typename Vec::index_type>(_table[i]);
@@ -45,7 +48,7 @@ private:
         return table;
     }
 
-    etl::array<index_type, Size> _table{make()};
+    static constexpr etl::array<index_type, Size> _table = make();
 };
 
 }  // namespace grit::fft
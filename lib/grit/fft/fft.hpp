@@ -1,5 +1,6 @@
 #pragma once
 
+#include <grit/core/config.hpp>
 #include <grit/fft/bitrevorder.hpp>
 #include <grit/fft/direction.hpp>
 #include <grit/math/ilog2.hpp>
@@ -21,17 +22,29 @@ namespace grit::fft {
 namespace detail {
 
 template<typename Float, unsigned Size>
-auto makeTwiddles(Direction dir = Direction::Forward) -> etl::array<etl::complex<Float>, Size / 2>
+constexpr auto makeTwiddles(Direction dir = Direction::Forward) -> etl::array<etl::complex<Float>, Size / 2>
 {
     auto const sign = dir == Direction::Forward ? Float(-1) : Float(1);
     auto table      = etl::array<etl::complex<Float>, Size / 2>{};
     for (unsigned i = 0; i < Size / 2; ++i) {
         auto const angle = sign * Float(2) * static_cast<Float>(etl::numbers::pi) * Float(i) / Float(Size);
-        table[i]         = etl::polar(Float(1), angle);
+        table[i]         = etl::complex<Float>{etl::cos(angle), etl::sin(angle)};
     }
     return table;
 }
 
+/// Forward twiddles, computed at compile-time and shared by all plans of the
+/// same size. Backward transforms use the conjugated view.
+template<typename Float, etl::size_t Size>
+inline constexpr auto twiddles = makeTwiddles<Float, Size>(Direction::Forward);
+
+template<typename Complex, etl::size_t Size>
+[[nodiscard]] constexpr auto twiddleView()
+{
+    using Float = typename Complex::value_type;
+    return etl::mdspan<Complex const, etl::extents<etl::size_t, Size / 2>>{twiddles<Float, Size>.data()};
+}
+
 template<typename Complex, int Order, int Stage>
 struct ComplexDit2Stage
 {
@@ -126,19 +139,262 @@ template<int Stage, etl::linalg::inout_vector InOutVec, etl::linalg::in_vector I
     }
 }
 
+/// Multiplies by W^(Size/4), which is -i for forward and +i for backward tables
+template<typename Complex>
+[[nodiscard]] TA_ALWAYS_INLINE inline auto rotateQuarter(Complex quarter, Complex x) -> Complex
+{
+    auto const s = quarter.imag();
+    return Complex{-s * x.imag(), s * x.real()};
+}
+
+template<typename Complex>
+TA_ALWAYS_INLINE inline auto
+radix4Butterfly(Complex& x0, Complex& x1, Complex& x2, Complex& x3, Complex quarter) -> void
+{
+    auto const apb = x0 + x1;
+    auto const amb = x0 - x1;
+    auto const cpd = x2 + x3;
+    auto const cmd = rotateQuarter(quarter, x2 - x3);
+
+    x0 = apb + cpd;
+    x1 = amb + cmd;
+    x2 = apb - cpd;
+    x3 = amb - cmd;
+}
+
+/// \brief Radix-2 decimation-in-frequency stage.
+/// \details Natural order input, bit-reversed order output. Stage 0 has the
+/// longest butterflies, the last two stages are fused into a twiddle-free
+/// radix-4 pass.
+template<typename Complex, int Order, int Stage>
+struct ComplexDif2Stage
+{
+    auto operator()(etl::linalg::inout_vector auto x, etl::linalg::in_vector auto w) -> void
+        requires(Stage + 2 < Order)
+    {
+        static constexpr auto const size        = 1 << Order;
+        static constexpr auto const stageLength = ipow<2>(Order - Stage - 1);
+        static constexpr auto const stride      = stageLength * 2;
+        static constexpr auto const twStride    = ipow<2>(Stage);
+
+        for (auto pair{0}; pair < stageLength; ++pair) {
+            auto const tw = w(pair * twStride);
+
+            for (auto k{pair}; k < size; k += stride) {
+                auto const i1 = k;
+                auto const i2 = k + stageLength;
+
+                auto const temp = x(i1) - x(i2);
+                x(i1)           = x(i1) + x(i2);
+                x(i2)           = tw * temp;
+            }
+        }
+
+        ComplexDif2Stage<Complex, Order, Stage + 1>{}(x, w);
+    }
+
+    auto operator()(etl::linalg::inout_vector auto x, etl::linalg::in_vector auto w) -> void
+        requires(Stage + 2 == Order)
+    {
+        static constexpr auto const size = 1 << Order;
+
+        // Radix-2 stages with length 2 & 1. Swapping the middle inputs turns
+        // them into the regular radix-4 butterfly.
+        auto const quarter = w(size / 4);
+        for (auto k{0}; k < size; k += 4) {
+            radix4Butterfly(x(k), x(k + 2), x(k + 1), x(k + 3), quarter);
+        }
+    }
+
+    auto operator()(etl::linalg::inout_vector auto x, etl::linalg::in_vector auto /*w*/) -> void
+        requires(Order == 1)
+    {
+        auto const temp = x(0) + x(1);
+        x(1)            = x(0) - x(1);
+        x(0)            = temp;
+    }
+};
+
+template<etl::size_t Size, etl::size_t Length, etl::linalg::inout_vector InOutVec, etl::linalg::in_vector InVec>
+    requires(Length >= Size)
+auto radix4Stage(InOutVec /*x*/, InVec /*w*/) -> void
+{}
+
+/// Fused radix-2 stages of length Length and 2*Length. The twiddle of the last
+/// quarter, W^3j, wraps past the table after j >= split and is negated.
+template<etl::size_t Size, etl::size_t Length, etl::linalg::inout_vector InOutVec, etl::linalg::in_vector InVec>
+    requires(Length < Size)
+auto radix4Stage(InOutVec x, InVec w) -> void
+{
+    static constexpr auto const size     = static_cast<int>(Size);
+    static constexpr auto const length   = static_cast<int>(Length);
+    static constexpr auto const stride   = length * 4;
+    static constexpr auto const twStride = size / stride;
+    static constexpr auto const half     = size / 2;
+    static constexpr auto const split    = (half + 3 * twStride - 1) / (3 * twStride);
+
+    using Complex = typename InOutVec::value_type;
+
+    auto const quarter = Complex(w(size / 4));
+
+    for (auto k{0}; k < size; k += stride) {
+        if constexpr (Length == 1) {
+            radix4Butterfly(x(k), x(k + 1), x(k + 2), x(k + 3), quarter);
+        } else {
+            auto butterfly = [&](int j, Complex w3) TA_ALWAYS_INLINE {
+                auto const i0 = k + j;
+                auto const i1 = i0 + length;
+                auto const i2 = i1 + length;
+                auto const i3 = i2 + length;
+
+                auto x0 = x(i0);
+                auto x1 = Complex(w(2 * j * twStride)) * x(i1);
+                auto x2 = Complex(w(j * twStride)) * x(i2);
+                auto x3 = w3 * x(i3);
+                radix4Butterfly(x0, x1, x2, x3, quarter);
+
+                x(i0) = x0;
+                x(i1) = x1;
+                x(i2) = x2;
+                x(i3) = x3;
+            };
+
+            for (auto j{0}; j < etl::min(split, length); ++j) {
+                butterfly(j, w(3 * j * twStride));
+            }
+            for (auto j{split}; j < length; ++j) {
+                butterfly(j, -Complex(w(3 * j * twStride - half)));
+            }
+        }
+    }
+
+    radix4Stage<Size, Length * 4>(x, w);
+}
+
+template<etl::size_t Size, etl::size_t Length, etl::linalg::inout_vector InOutVec, etl::linalg::in_vector InVec>
+auto splitRadix(InOutVec x, InVec w, int offset) -> void
+{
+    static constexpr auto const length = static_cast<int>(Length);
+
+    if constexpr (Length == 1) {
+        return;
+    } else if constexpr (Length == 2) {
+        auto const temp = x(offset) + x(offset + 1);
+        x(offset + 1)   = x(offset) - x(offset + 1);
+        x(offset)       = temp;
+    } else if constexpr (Length == 4) {
+        using Complex      = typename InOutVec::value_type;
+        auto const quarter = Complex(w(static_cast<int>(Size / 4)));
+        radix4Butterfly(x(offset), x(offset + 1), x(offset + 2), x(offset + 3), quarter);
+    } else {
+        static constexpr auto const quarterLength = length / 4;
+        static constexpr auto const twStride      = static_cast<int>(Size / Length);
+
+        splitRadix<Size, Length / 2>(x, w, offset);
+        splitRadix<Size, Length / 4>(x, w, offset + quarterLength * 2);
+        splitRadix<Size, Length / 4>(x, w, offset + quarterLength * 3);
+
+        static constexpr auto const half  = static_cast<int>(Size / 2);
+        static constexpr auto const split = (half + 3 * twStride - 1) / (3 * twStride);
+
+        using Complex = typename InOutVec::value_type;
+
+        auto const quarter = Complex(w(static_cast<int>(Size / 4)));
+
+        auto butterfly = [&](int k, Complex w3) TA_ALWAYS_INLINE {
+            auto const i0 = offset + k;
+            auto const i1 = i0 + quarterLength;
+            auto const i2 = i1 + quarterLength;
+            auto const i3 = i2 + quarterLength;
+
+            auto const u0 = x(i0);
+            auto const u1 = x(i1);
+            auto const z0 = Complex(w(k * twStride)) * x(i2);
+            auto const z1 = w3 * x(i3);
+
+            auto const sum  = z0 + z1;
+            auto const diff = rotateQuarter(quarter, z0 - z1);
+
+            x(i0) = u0 + sum;
+            x(i2) = u0 - sum;
+            x(i1) = u1 + diff;
+            x(i3) = u1 - diff;
+        };
+
+        for (auto k{0}; k < etl::min(split, quarterLength); ++k) {
+            butterfly(k, w(3 * k * twStride));
+        }
+        for (auto k{split}; k < quarterLength; ++k) {
+            butterfly(k, -Complex(w(3 * k * twStride - half)));
+        }
+    }
+}
+
 }  // namespace detail
 
+/// \brief Radix-2 decimation-in-time kernel.
+/// \details Expects the input in bit-reversed order and one twiddle per
+/// butterfly, W^k for k in [0, Size/2).
 /// \ingroup grit-fft
-template<typename Complex, etl::size_t Size>
+struct Radix2Kernel
+{
+    template<etl::size_t Size, etl::linalg::inout_vector InOutVec, etl::linalg::in_vector InVec>
+    static auto transform(InOutVec x, InVec w) -> void
+    {
+        detail::ComplexDit2Stage<typename InOutVec::value_type, ilog2(Size), 0>{}(x, w);
+    }
+};
+
+/// \brief Radix-4 decimation-in-time kernel.
+/// \details Fuses two radix-2 stages into a single pass with three complex
+/// multiplies per 4-point butterfly instead of four. Odd orders run one
+/// twiddle-free radix-2 stage first. Same input order and twiddle table as
+/// Radix2Kernel.
+/// \ingroup grit-fft
+struct Radix4Kernel
+{
+    template<etl::size_t Size, etl::linalg::inout_vector InOutVec, etl::linalg::in_vector InVec>
+    static auto transform(InOutVec x, InVec w) -> void
+    {
+        static constexpr auto const size  = static_cast<int>(Size);
+        static constexpr auto const order = static_cast<int>(ilog2(Size));
+
+        if constexpr (order % 2 == 1) {
+            for (auto k{0}; k < size; k += 2) {
+                auto const temp = x(k) + x(k + 1);
+                x(k + 1)        = x(k) - x(k + 1);
+                x(k)            = temp;
+            }
+            detail::radix4Stage<Size, 2>(x, w);
+        } else {
+            detail::radix4Stage<Size, 1>(x, w);
+        }
+    }
+};
+
+/// \brief Split-radix decimation-in-time kernel.
+/// \details Recursively splits into one half-size and two quarter-size
+/// transforms, which needs the fewest real multiplies of the power-of-two
+/// kernels. Same input order and twiddle table as Radix2Kernel.
+/// \ingroup grit-fft
+struct SplitRadixKernel
+{
+    template<etl::size_t Size, etl::linalg::inout_vector InOutVec, etl::linalg::in_vector InVec>
+    static auto transform(InOutVec x, InVec w) -> void
+    {
+        detail::splitRadix<Size, Size>(x, w, 0);
+    }
+};
+
+/// \ingroup grit-fft
+template<typename Complex, etl::size_t Size, typename Kernel = Radix2Kernel>
 struct ComplexPlan
 {
     using ValueType = Complex;
     using SizeType  = etl::size_t;
 
-    explicit ComplexPlan(Direction defaultDirection = Direction::Forward)
-        : _defaultDirection{defaultDirection}
-        , _w{detail::makeTwiddles<typename Complex::value_type, size()>(defaultDirection)}
-    {}
+    /// The twiddles are shared static tables, the direction is picked per call.
+    explicit constexpr ComplexPlan([[maybe_unused]] Direction defaultDirection = Direction::Forward) {}
 
     [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
 
@@ -150,19 +406,17 @@ struct ComplexPlan
     {
         _reorder(x);
 
-        auto const w = etl::mdspan<Complex, etl::extents<etl::size_t, size()>>{_w.data()};
+        auto const w = detail::twiddleView<Complex, size()>();
 
-        if (dir == _defaultDirection) {
-            detail::ComplexDit2Stage<Complex, order(), 0>{}(x, w);
+        if (dir == Direction::Forward) {
+            Kernel::template transform<size()>(x, w);
         } else {
-            detail::ComplexDit2Stage<Complex, order(), 0>{}(x, etl::linalg::conjugated(w));
+            Kernel::template transform<size()>(x, etl::linalg::conjugated(w));
         }
     }
 
 private:
-    Direction _defaultDirection;
-    BitrevorderPlan<size()> _reorder{};
-    etl::array<Complex, size() / 2> _w;
+    TETL_NO_UNIQUE_ADDRESS BitrevorderPlan<size()> _reorder{};
 };
 
 /// \ingroup grit-fft
@@ -172,10 +426,8 @@ struct ComplexPlanV2
     using ValueType = Complex;
     using SizeType  = etl::size_t;
 
-    explicit ComplexPlanV2(Direction defaultDirection = Direction::Forward)
-        : _defaultDirection{defaultDirection}
-        , _w{detail::makeTwiddles<typename Complex::value_type, size()>(defaultDirection)}
-    {}
+    /// The twiddles are shared static tables, the direction is picked per call.
+    explicit constexpr ComplexPlanV2([[maybe_unused]] Direction defaultDirection = Direction::Forward) {}
 
     [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
 
@@ -191,9 +443,9 @@ struct ComplexPlanV2
 
         _reorder(x);
 
-        auto const w = etl::mdspan<Complex, etl::extents<etl::size_t, size()>>{_w.data()};
+        auto const w = detail::twiddleView<Complex, size()>();
 
-        if (dir == _defaultDirection) {
+        if (dir == Direction::Forward) {
             runStages(etl::make_index_sequence<order()>(), w);
         } else {
             runStages(etl::make_index_sequence<order()>(), etl::linalg::conjugated(w));
@@ -201,9 +453,7 @@ struct ComplexPlanV2
     }
 
 private:
-    Direction _defaultDirection;
-    BitrevorderPlan<size()> _reorder{};
-    etl::array<Complex, size() / 2> _w;
+    TETL_NO_UNIQUE_ADDRESS BitrevorderPlan<size()> _reorder{};
 };
 
 }  // namespace grit::fft
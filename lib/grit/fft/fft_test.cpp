@@ -1,7 +1,11 @@
 #include "fft.hpp"
 
+#include <etl/random.hpp>
+
 #include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 namespace {
 
@@ -32,6 +36,42 @@ auto test() -> void
     }
 }
 
+template<typename Complex, etl::size_t Size, typename Kernel>
+auto testKernel() -> void
+{
+    using Float = typename Complex::value_type;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(1)};
+
+    auto input = etl::array<Complex, Size>{};
+    etl::generate(input.begin(), input.end(), [&] { return Complex{dist(rng), dist(rng)}; });
+
+    auto expected = input;
+    auto actual   = input;
+
+    auto reference = grit::fft::ComplexPlan<Complex, Size, grit::fft::Radix2Kernel>{};
+    auto plan      = grit::fft::ComplexPlan<Complex, Size, Kernel>{};
+
+    auto const tolerance = etl::same_as<Float, float> ? 1e-3 : 1e-9;
+    for (auto const dir : {grit::fft::Direction::Forward, grit::fft::Direction::Backward}) {
+        reference(etl::mdspan{expected.data(), etl::extents{Size}}, dir);
+        plan(etl::mdspan{actual.data(), etl::extents{Size}}, dir);
+
+        for (auto i = etl::size_t(0); i < Size; ++i) {
+            CAPTURE(i);
+            REQUIRE_THAT(actual[i].real(), Catch::Matchers::WithinAbs(expected[i].real(), tolerance));
+            REQUIRE_THAT(actual[i].imag(), Catch::Matchers::WithinAbs(expected[i].imag(), tolerance));
+        }
+    }
+
+    for (auto i = etl::size_t(0); i < Size; ++i) {
+        CAPTURE(i);
+        REQUIRE_THAT(actual[i].real() / Float(Size), Catch::Matchers::WithinAbs(input[i].real(), tolerance));
+        REQUIRE_THAT(actual[i].imag() / Float(Size), Catch::Matchers::WithinAbs(input[i].imag(), tolerance));
+    }
+}
+
 }  // namespace
 
 TEMPLATE_TEST_CASE("fft: ComplexPlan", "", etl::complex<float>, etl::complex<double>)
@@ -51,3 +91,43 @@ TEMPLATE_TEST_CASE("fft: ComplexPlanV2", "", etl::complex<float>, etl::complex<d
     test<grit::fft::ComplexPlanV2<TestType, 512>>();
     test<grit::fft::ComplexPlanV2<TestType, 1024>>();
 }
+
+template<typename Complex, typename Kernel>
+static auto testKernelSizes() -> void
+{
+    test<grit::fft::ComplexPlan<Complex, 64, Kernel>>();
+    test<grit::fft::ComplexPlan<Complex, 128, Kernel>>();
+
+    testKernel<Complex, 2, Kernel>();
+    testKernel<Complex, 4, Kernel>();
+    testKernel<Complex, 8, Kernel>();
+    testKernel<Complex, 16, Kernel>();
+    testKernel<Complex, 32, Kernel>();
+    testKernel<Complex, 256, Kernel>();
+    testKernel<Complex, 512, Kernel>();
+    testKernel<Complex, 1024, Kernel>();
+}
+
+TEMPLATE_TEST_CASE("fft: ComplexPlan kernels", "", grit::fft::Radix4Kernel, grit::fft::SplitRadixKernel)
+{
+    testKernelSizes<etl::complex<float>, TestType>();
+    testKernelSizes<etl::complex<double>, TestType>();
+}
+
+TEMPLATE_TEST_CASE("fft: twiddles", "", float, double)
+{
+    using Float = TestType;
+
+    static constexpr auto const& w = grit::fft::detail::twiddles<Float, 8>;
+    STATIC_REQUIRE(w.size() == 4);
+    STATIC_REQUIRE(w[0].real() == Float(1));
+    STATIC_REQUIRE(w[0].imag() == Float(0));
+
+    REQUIRE(w[1].real() == Catch::Approx(+etl::sqrt(Float(0.5))));
+    REQUIRE(w[1].imag() == Catch::Approx(-etl::sqrt(Float(0.5))));
+    REQUIRE(w[2].real() == Catch::Approx(Float(0)).margin(1e-6));
+    REQUIRE(w[2].imag() == Catch::Approx(Float(-1)));
+
+    STATIC_REQUIRE(sizeof(grit::fft::ComplexPlan<etl::complex<Float>, 1024>) == 1);
+    STATIC_REQUIRE(sizeof(grit::fft::ComplexPlanV2<etl::complex<Float>, 1024>) == 1);
+}
@@ -0,0 +1,86 @@
+#include "fixed_point_plan.hpp"
+
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+namespace {
+
+template<etl::size_t Size>
+auto snr(grit::fft::Direction dir, double amplitude) -> double
+{
+    using Complex = etl::complex<double>;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<double>{-amplitude, amplitude};
+
+    auto packed = etl::array<grit::fft::PackedComplexQ15, Size>{};
+    auto input  = etl::array<Complex, Size>{};
+    for (auto i = etl::size_t(0); i < Size; ++i) {
+        packed[i] = grit::fft::packComplexQ15(Complex{dist(rng), dist(rng)});
+        input[i]  = grit::fft::unpackComplexQ15<double>(packed[i]);
+    }
+
+    auto reference = grit::fft::ComplexPlan<Complex, Size>{};
+    reference(etl::mdspan{input.data(), etl::extents{Size}}, dir);
+
+    auto plan           = grit::fft::ComplexPlanQ15<Size>{};
+    auto const exponent = plan(etl::mdspan{packed.data(), etl::extents{Size}}, dir);
+
+    auto signal = 0.0;
+    auto noise  = 0.0;
+    for (auto i = etl::size_t(0); i < Size; ++i) {
+        auto const error = grit::fft::unpackComplexQ15<double>(packed[i], exponent) - input[i];
+        signal += etl::norm(input[i]);
+        noise += etl::norm(error);
+    }
+    return 10.0 * etl::log10(signal / noise);
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE_SIG(
+    "fft: ComplexPlanQ15",
+    "",
+    ((etl::size_t Size), Size),
+    (4),
+    (16),
+    (256),
+    (512),
+    (1024)
+)
+{
+    for (auto const dir : {grit::fft::Direction::Forward, grit::fft::Direction::Backward}) {
+        REQUIRE(snr<Size>(dir, 1.0) > 60.0);
+        REQUIRE(snr<Size>(dir, 0.01) > 50.0);
+    }
+}
+
+TEST_CASE("fft: ComplexPlanQ15 impulse")
+{
+    static constexpr auto size = etl::size_t(64);
+
+    auto buffer = etl::array<grit::fft::PackedComplexQ15, size>{};
+    auto x      = etl::mdspan{buffer.data(), etl::extents{size}};
+    buffer[0]   = grit::fft::packComplexQ15(grit::Q15::fromFloat(0.25), grit::Q15{});
+
+    auto plan           = grit::fft::ComplexPlanQ15<size>{};
+    auto const exponent = plan(x, grit::fft::Direction::Forward);
+    REQUIRE(exponent == 0);
+
+    for (auto const bin : buffer) {
+        auto const value = grit::fft::unpackComplexQ15<double>(bin, exponent);
+        REQUIRE_THAT(value.real(), Catch::Matchers::WithinAbs(0.25, 1e-4));
+        REQUIRE_THAT(value.imag(), Catch::Matchers::WithinAbs(0.0, 1e-4));
+    }
+
+    // Flat spectrum back to the impulse, 64 times louder, the block exponent carries the gain.
+    auto const inverse = plan(x, grit::fft::Direction::Backward);
+    REQUIRE(inverse > 0);
+    auto const dc   = grit::fft::unpackComplexQ15<double>(buffer[0], inverse);
+    auto const next = grit::fft::unpackComplexQ15<double>(buffer[1], inverse);
+    REQUIRE_THAT(dc.real(), Catch::Matchers::WithinAbs(16.0, 0.05));
+    REQUIRE_THAT(next.real(), Catch::Matchers::WithinAbs(0.0, 0.05));
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <grit/fft/direction.hpp>
+#include <grit/fft/fft.hpp>
+
+#include <etl/array.hpp>
+#include <etl/complex.hpp>
+#include <etl/concepts.hpp>
+#include <etl/cstddef.hpp>
+#include <etl/linalg.hpp>
+#include <etl/mdspan.hpp>
+
+namespace grit::fft {
+
+/// \brief Real-to-complex & complex-to-real fft.
+///
+/// \details Packs the even/odd samples into a complex buffer of Size/2, runs a
+/// ComplexPlanV2 of half the size and untangles the result with a post-twiddle
+/// split step. The spectrum is returned as the Size/2+1 non-negative bins, the
+/// remaining bins follow from hermitian symmetry.
+///
+/// The split twiddles are the first quarter of the shared Size twiddle table.
+/// Like ComplexPlan, the backward transform is unnormalized. A roundtrip scales
+/// the signal by Size.
+///
+/// \ingroup grit-fft
+template<etl::floating_point Float, etl::size_t Size>
+    requires(Size >= 4)
+struct RealPlan
+{
+    using ValueType   = Float;
+    using ComplexType = etl::complex<Float>;
+    using SizeType    = etl::size_t;
+
+    RealPlan() = default;
+
+    [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
+
+    [[nodiscard]] static constexpr auto order() -> etl::size_t { return ilog2(Size); }
+
+    /// Number of complex bins, Size/2+1
+    [[nodiscard]] static constexpr auto numBins() -> etl::size_t { return Size / 2 + 1; }
+
+    /// Real-to-complex. Input has size() samples, output numBins() bins.
+    template<etl::linalg::in_vector InVec, etl::linalg::out_vector OutVec>
+        requires(etl::same_as<typename InVec::value_type, Float>
+                 and etl::same_as<typename OutVec::value_type, ComplexType>)
+    auto operator()(InVec input, OutVec output) -> void
+    {
+        auto z = buffer();
+        for (auto i = etl::size_t(0); i < halfSize; ++i) {
+            z(i) = ComplexType{input(2 * i), input(2 * i + 1)};
+        }
+
+        _plan(z, Direction::Forward);
+
+        auto const& w = detail::twiddles<Float, Size>;
+
+        // X[k] = E[k] + W^k O[k], X[N/2-k] = conj(E[k] - W^k O[k])
+        for (auto k = etl::size_t(0); k <= Size / 4; ++k) {
+            auto const zk = z(k);
+            auto const zn = etl::conj(z((halfSize - k) % halfSize));
+
+            auto const even = (zk + zn) * Float(0.5);
+            auto const odd  = (zk - zn) * ComplexType{Float(0), Float(-0.5)};
+            auto const wOdd = w[k] * odd;
+
+            output(k)            = even + wOdd;
+            output(halfSize - k) = etl::conj(even - wOdd);
+        }
+    }
+
+    /// Complex-to-real. Input has numBins() bins, output size() samples.
+    template<etl::linalg::in_vector InVec, etl::linalg::out_vector OutVec>
+        requires(etl::same_as<typename InVec::value_type, ComplexType>
+                 and etl::same_as<typename OutVec::value_type, Float>)
+    auto operator()(InVec input, OutVec output) -> void
+    {
+        auto z          = buffer();
+        auto const& w   = detail::twiddles<Float, Size>;
+        auto const unit = ComplexType{Float(0), Float(1)};
+
+        // Z[k] = E[k] + i O[k], Z[N/2-k] = conj(E[k]) + i conj(O[k])
+        for (auto k = etl::size_t(0); k <= Size / 4; ++k) {
+            auto const xk = input(k);
+            auto const xn = etl::conj(input(halfSize - k));
+
+            auto const even = xk + xn;
+            auto const odd  = (xk - xn) * etl::conj(w[k]);
+
+            z(k) = even + unit * odd;
+            if (k != 0) {
+                z(halfSize - k) = etl::conj(even) + unit * etl::conj(odd);
+            }
+        }
+
+        _plan(z, Direction::Backward);
+
+        for (auto i = etl::size_t(0); i < halfSize; ++i) {
+            output(2 * i)     = z(i).real();
+            output(2 * i + 1) = z(i).imag();
+        }
+    }
+
+private:
+    static constexpr auto halfSize = Size / 2;
+
+    [[nodiscard]] auto buffer() { return etl::mdspan<ComplexType, etl::extents<etl::size_t, halfSize>>{_buf.data()}; }
+
+    TETL_NO_UNIQUE_ADDRESS ComplexPlanV2<ComplexType, halfSize> _plan{};
+    etl::array<ComplexType, halfSize> _buf{};
+};
+
+}  // namespace grit::fft
@@ -0,0 +1,66 @@
+#include "real_plan.hpp"
+
+#include <etl/random.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+namespace {
+
+template<typename Float, etl::size_t Size>
+auto testRealPlan() -> void
+{
+    using Complex = etl::complex<Float>;
+    using Plan    = grit::fft::RealPlan<Float, Size>;
+
+    STATIC_REQUIRE(Plan::size() == Size);
+    STATIC_REQUIRE(Plan::numBins() == Size / 2 + 1);
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(1)};
+
+    auto signal = etl::array<Float, Size>{};
+    etl::generate(signal.begin(), signal.end(), [&] { return dist(rng); });
+
+    auto reference = etl::array<Complex, Size>{};
+    for (auto i = etl::size_t(0); i < Size; ++i) {
+        reference[i] = Complex{signal[i], Float(0)};
+    }
+    auto complexPlan = grit::fft::ComplexPlanV2<Complex, Size>{};
+    complexPlan(etl::mdspan{reference.data(), etl::extents{Size}}, grit::fft::Direction::Forward);
+
+    auto plan     = Plan{};
+    auto spectrum = etl::array<Complex, Plan::numBins()>{};
+    auto x        = etl::mdspan{signal.data(), etl::extents{Size}};
+    auto bins     = etl::mdspan{spectrum.data(), etl::extents{spectrum.size()}};
+    plan(x, bins);
+
+    auto const tolerance = etl::same_as<Float, float> ? 1e-3 : 1e-9;
+    for (auto k = etl::size_t(0); k < spectrum.size(); ++k) {
+        CAPTURE(k);
+        REQUIRE_THAT(spectrum[k].real(), Catch::Matchers::WithinAbs(reference[k].real(), tolerance));
+        REQUIRE_THAT(spectrum[k].imag(), Catch::Matchers::WithinAbs(reference[k].imag(), tolerance));
+    }
+
+    auto roundtrip = etl::array<Float, Size>{};
+    plan(bins, etl::mdspan{roundtrip.data(), etl::extents{Size}});
+    for (auto i = etl::size_t(0); i < Size; ++i) {
+        CAPTURE(i);
+        REQUIRE_THAT(roundtrip[i] / Float(Size), Catch::Matchers::WithinAbs(signal[i], tolerance));
+    }
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("fft: RealPlan", "", float, double)
+{
+    testRealPlan<TestType, 4>();
+    testRealPlan<TestType, 8>();
+    testRealPlan<TestType, 64>();
+    testRealPlan<TestType, 128>();
+    testRealPlan<TestType, 256>();
+    testRealPlan<TestType, 512>();
+    testRealPlan<TestType, 1024>();
+}
@@ -2,7 +2,10 @@
 
 /// \defgroup grit-math Math
 
+#include <grit/math/antiderivative_lookup_table.hpp>
 #include <grit/math/buffer_interpolation.hpp>
+#include <grit/math/fast.hpp>
+#include <grit/math/fixed_point.hpp>
 #include <grit/math/hermite_interpolation.hpp>
 #include <grit/math/ilog2.hpp>
 #include <grit/math/ipow.hpp>
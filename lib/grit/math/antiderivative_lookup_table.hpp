@@ -0,0 +1,132 @@
+#pragma once
+
+#include <etl/array.hpp>
+#include <etl/concepts.hpp>
+
+namespace grit {
+
+/// \brief Lookup table for a function and its first two antiderivatives.
+///
+/// \details The function is sampled at Size points in [min, max] and linearly
+/// interpolated, like StaticLookupTableTransform. The antiderivatives are the
+/// exact integrals of that piecewise linear function, stored as cumulative
+/// sums per point & evaluated as a quadratic/cubic inside the segment. So
+/// antiderivative1() is exactly the integral of operator() and
+/// antiderivative2() of antiderivative1(), which higher order antiderivative
+/// antialiasing depends on. Interpolating tabulated antiderivatives linearly
+/// would flatten their curvature inside each segment.
+///
+/// Outside of the range the function is held at its edge values and the
+/// antiderivatives continue accordingly. Both antiderivatives are zero at
+/// the point closest to the middle of the range, with a symmetric range at 0.
+///
+/// \ingroup grit-math
+template<etl::floating_point Float, etl::size_t Size>
+struct AntiderivativeLookupTable
+{
+    static_assert(Size >= 2);
+
+    using ValueType = Float;
+    using SizeType  = etl::size_t;
+
+    template<etl::regular_invocable<Float> Function>
+    explicit constexpr AntiderivativeLookupTable(Function func, Float min, Float max);
+
+    [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
+
+    [[nodiscard]] constexpr auto operator()(Float x) const -> Float;
+    [[nodiscard]] constexpr auto antiderivative1(Float x) const -> Float;
+    [[nodiscard]] constexpr auto antiderivative2(Float x) const -> Float;
+
+private:
+    struct Segment
+    {
+        etl::size_t index;
+        Float t;
+        Float slope;
+    };
+
+    [[nodiscard]] constexpr auto segment(Float x) const -> Segment;
+
+    Float _min;
+    Float _step;
+    Float _scaler;
+    etl::array<Float, Size> _f{};
+    etl::array<Float, Size> _ad1{};
+    etl::array<Float, Size> _ad2{};
+};
+
+template<etl::floating_point Float, etl::size_t Size>
+template<etl::regular_invocable<Float> Function>
+constexpr AntiderivativeLookupTable<Float, Size>::AntiderivativeLookupTable(Function func, Float min, Float max)
+    : _min{min}
+    , _step{(max - min) / static_cast<Float>(Size - 1)}
+    , _scaler{static_cast<Float>(Size - 1) / (max - min)}
+{
+    // Integrated in double from the middle outwards, the values near 0 stay small.
+    auto const h = (static_cast<double>(max) - static_cast<double>(min)) / static_cast<double>(Size - 1);
+    auto f       = etl::array<double, Size>{};
+    auto ad1     = etl::array<double, Size>{};
+    auto ad2     = etl::array<double, Size>{};
+    for (auto i = etl::size_t(0); i < Size; ++i) {
+        f[i] = static_cast<double>(func(static_cast<Float>(static_cast<double>(min) + h * static_cast<double>(i))));
+    }
+
+    auto const middle = Size / 2;
+    for (auto i = middle; i + 1 < Size; ++i) {
+        ad1[i + 1] = ad1[i] + h * (f[i] + f[i + 1]) / 2.0;
+        ad2[i + 1] = ad2[i] + h * ad1[i] + h * h * (f[i] / 3.0 + f[i + 1] / 6.0);
+    }
+    for (auto i = middle; i > 0; --i) {
+        ad1[i - 1] = ad1[i] - h * (f[i - 1] + f[i]) / 2.0;
+        ad2[i - 1] = ad2[i] - h * ad1[i - 1] - h * h * (f[i - 1] / 3.0 + f[i] / 6.0);
+    }
+
+    for (auto i = etl::size_t(0); i < Size; ++i) {
+        _f[i]   = static_cast<Float>(f[i]);
+        _ad1[i] = static_cast<Float>(ad1[i]);
+        _ad2[i] = static_cast<Float>(ad2[i]);
+    }
+}
+
+template<etl::floating_point Float, etl::size_t Size>
+constexpr auto AntiderivativeLookupTable<Float, Size>::segment(Float x) const -> Segment
+{
+    auto const position = (x - _min) * _scaler;
+    if (position <= Float(0)) {
+        return {0, position, Float(0)};
+    }
+    if (position >= static_cast<Float>(Size - 1)) {
+        return {Size - 1, position - static_cast<Float>(Size - 1), Float(0)};
+    }
+
+    // Relative to the segment start, x - min would round away the low bits that
+    // the divided differences in antiderivative antialiasing depend on.
+    auto const index = static_cast<etl::size_t>(position);
+    auto const start = _min + _step * static_cast<Float>(index);
+    return {index, (x - start) * _scaler, _f[index + 1] - _f[index]};
+}
+
+template<etl::floating_point Float, etl::size_t Size>
+constexpr auto AntiderivativeLookupTable<Float, Size>::operator()(Float x) const -> Float
+{
+    auto const [i, t, slope] = segment(x);
+    return _f[i] + slope * t;
+}
+
+template<etl::floating_point Float, etl::size_t Size>
+constexpr auto AntiderivativeLookupTable<Float, Size>::antiderivative1(Float x) const -> Float
+{
+    auto const [i, t, slope] = segment(x);
+    return _ad1[i] + _step * t * (_f[i] + slope * t * Float(0.5));
+}
+
+template<etl::floating_point Float, etl::size_t Size>
+constexpr auto AntiderivativeLookupTable<Float, Size>::antiderivative2(Float x) const -> Float
+{
+    auto const [i, t, slope] = segment(x);
+    auto const f             = _f[i] * Float(0.5) + slope * t * (Float(1) / Float(6));
+    return _ad2[i] + _step * t * (_ad1[i] + _step * t * f);
+}
+
+}  // namespace grit
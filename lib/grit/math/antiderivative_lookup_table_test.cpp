@@ -0,0 +1,53 @@
+#include "antiderivative_lookup_table.hpp"
+
+#include <etl/cmath.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+TEMPLATE_TEST_CASE("math: AntiderivativeLookupTable", "", float, double)
+{
+    using Float = TestType;
+
+    // Linear interpolation is exact for a linear function, so are the integrals.
+    static constexpr auto identity = grit::AntiderivativeLookupTable<Float, 33>{[](Float x) { return x; }, -2, +2};
+    STATIC_REQUIRE(identity.size() == 33);
+    STATIC_REQUIRE(identity(Float(0.5)) == Float(0.5));
+
+    for (auto const x : {-1.9, -1.0, -0.3, 0.0, 0.11, 0.5, 1.7}) {
+        auto const v = Float(x);
+        REQUIRE(identity(v) == Catch::Approx(x));
+        REQUIRE(identity.antiderivative1(v) == Catch::Approx(x * x / 2.0).margin(1e-6));
+        REQUIRE(identity.antiderivative2(v) == Catch::Approx(x * x * x / 6.0).margin(1e-6));
+    }
+
+    // Held at the edge value outside of the range, the integrals continue with it.
+    REQUIRE(identity(Float(3)) == Catch::Approx(2.0));
+    REQUIRE(identity.antiderivative1(Float(3)) == Catch::Approx(2.0 + 2.0));
+    REQUIRE(identity.antiderivative2(Float(3)) == Catch::Approx(8.0 / 6.0 + 2.0 + 1.0));
+    REQUIRE(identity(Float(-3)) == Catch::Approx(-2.0));
+    REQUIRE(identity.antiderivative1(Float(-3)) == Catch::Approx(2.0 + 2.0));
+    REQUIRE(identity.antiderivative2(Float(-3)) == Catch::Approx(-8.0 / 6.0 - 2.0 - 1.0));
+}
+
+TEST_CASE("math: AntiderivativeLookupTable tanh")
+{
+    static constexpr auto table = grit::AntiderivativeLookupTable<double, 1025>{
+        [](double x) { return etl::tanh(x); },
+        -8.0,
+        +8.0,
+    };
+
+    for (auto x = -9.0; x < 9.0; x += 0.0123) {
+        CAPTURE(x);
+        REQUIRE(table(x) == Catch::Approx(etl::tanh(x)).margin(1e-4));
+        REQUIRE(table.antiderivative1(x) == Catch::Approx(etl::log(etl::cosh(x))).margin(1e-4));
+
+        // ad2 is the integral of ad1 & ad1 of f.
+        auto const h = 1e-4;
+        auto const d2 = (table.antiderivative2(x + h) - table.antiderivative2(x - h)) / (2.0 * h);
+        auto const d1 = (table.antiderivative1(x + h) - table.antiderivative1(x - h)) / (2.0 * h);
+        REQUIRE(d2 == Catch::Approx(table.antiderivative1(x)).margin(1e-6));
+        REQUIRE(d1 == Catch::Approx(table(x)).margin(1e-6));
+    }
+}
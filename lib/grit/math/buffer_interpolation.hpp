@@ -3,6 +3,7 @@
 #include <grit/math/hermite_interpolation.hpp>
 #include <grit/math/linear_interpolation.hpp>
 
+#include <etl/array.hpp>
 #include <etl/linalg.hpp>
 #include <etl/mdspan.hpp>
 
@@ -45,6 +46,120 @@ struct BufferInterpolation
             return hermiteInterpolation(xm1, x0, x1, x2, fracPos);
         }
     };
+
+    /// \brief Third order lagrange over the same four points as Hermite.
+    struct Lagrange
+    {
+        template<etl::linalg::in_vector Vec, typename Float = typename Vec::value_type>
+        [[nodiscard]] constexpr auto operator()(Vec buffer, etl::size_t readPos, Float fracPos) -> Float
+        {
+            auto const pos = readPos + buffer.size();
+            auto const xm1 = buffer((pos - 1) % buffer.size());
+            auto const x0  = buffer(pos % buffer.size());
+            auto const x1  = buffer((pos + 1) % buffer.size());
+            auto const x2  = buffer((pos + 2) % buffer.size());
+
+            auto const dm1 = fracPos + Float(1);
+            auto const d1  = fracPos - Float(1);
+            auto const d2  = fracPos - Float(2);
+
+            auto const cm1 = -fracPos * d1 * d2 / Float(6);
+            auto const c0  = dm1 * d1 * d2 / Float(2);
+            auto const c1  = -dm1 * fracPos * d2 / Float(2);
+            auto const c2  = dm1 * fracPos * d1 / Float(6);
+            return cm1 * xm1 + c0 * x0 + c1 * x1 + c2 * x2;
+        }
+    };
+
+    /// \brief Linear, wraps with a bit mask instead of a modulo.
+    /// \pre buffer.size() is a power of two
+    struct MaskedLinear
+    {
+        template<etl::linalg::in_vector Vec, typename Float = typename Vec::value_type>
+        [[nodiscard]] constexpr auto operator()(Vec buffer, etl::size_t readPos, Float fracPos) -> Float
+        {
+            auto const mask = buffer.size() - 1;
+            auto const x0   = buffer(readPos & mask);
+            auto const x1   = buffer((readPos + 1) & mask);
+            return linearInterpolation(x0, x1, fracPos);
+        }
+    };
+
+    /// \brief Hermite, wraps with a bit mask instead of a modulo.
+    /// \pre buffer.size() is a power of two
+    struct MaskedHermite
+    {
+        template<etl::linalg::in_vector Vec, typename Float = typename Vec::value_type>
+        [[nodiscard]] constexpr auto operator()(Vec buffer, etl::size_t readPos, Float fracPos) -> Float
+        {
+            auto const mask = buffer.size() - 1;
+            auto const xm1  = buffer((readPos - 1) & mask);
+            auto const x0   = buffer(readPos & mask);
+            auto const x1   = buffer((readPos + 1) & mask);
+            auto const x2   = buffer((readPos + 2) & mask);
+            return hermiteInterpolation(xm1, x0, x1, x2, fracPos);
+        }
+    };
+
+    /// \brief Linear without any wrapping, for tables made by makeGuardedTable().
+    /// \pre readPos < buffer.size() - guardPoints
+    struct GuardedLinear
+    {
+        static constexpr auto guardPoints = etl::size_t(3);
+
+        template<etl::linalg::in_vector Vec, typename Float = typename Vec::value_type>
+        [[nodiscard]] constexpr auto operator()(Vec buffer, etl::size_t readPos, Float fracPos) -> Float
+        {
+            return linearInterpolation(buffer(readPos + 1), buffer(readPos + 2), fracPos);
+        }
+    };
+
+    /// \brief Hermite without any wrapping, for tables made by makeGuardedTable().
+    /// \pre readPos < buffer.size() - guardPoints
+    struct GuardedHermite
+    {
+        static constexpr auto guardPoints = etl::size_t(3);
+
+        template<etl::linalg::in_vector Vec, typename Float = typename Vec::value_type>
+        [[nodiscard]] constexpr auto operator()(Vec buffer, etl::size_t readPos, Float fracPos) -> Float
+        {
+            auto const xm1 = buffer(readPos);
+            auto const x0  = buffer(readPos + 1);
+            auto const x1  = buffer(readPos + 2);
+            auto const x2  = buffer(readPos + 3);
+            return hermiteInterpolation(xm1, x0, x1, x2, fracPos);
+        }
+    };
 };
 
+/// \brief Number of extra samples the interpolation expects around a table.
+/// \relates BufferInterpolation
+/// \ingroup grit-math
+template<typename Interpolation>
+inline constexpr auto bufferGuardPoints = etl::size_t(0);
+
+template<typename Interpolation>
+    requires requires { Interpolation::guardPoints; }
+inline constexpr auto bufferGuardPoints<Interpolation> = Interpolation::guardPoints;
+
+/// \brief Copy of a periodic table with one guard point before & two after.
+///
+/// \details Sample i is stored at index i+1, so the guarded interpolations
+/// can read their neighbours without wrapping.
+///
+/// \relates BufferInterpolation
+/// \ingroup grit-math
+template<typename Float, etl::size_t Size>
+[[nodiscard]] constexpr auto makeGuardedTable(etl::array<Float, Size> const& table) -> etl::array<Float, Size + 3>
+{
+    auto guarded = etl::array<Float, Size + 3>{};
+    guarded[0]   = table[Size - 1];
+    for (auto i = etl::size_t(0); i < Size; ++i) {
+        guarded[i + 1] = table[i];
+    }
+    guarded[Size + 1] = table[0];
+    guarded[Size + 2] = table[1 % Size];
+    return guarded;
+}
+
 }  // namespace grit
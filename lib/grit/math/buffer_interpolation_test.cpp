@@ -0,0 +1,95 @@
+#include "buffer_interpolation.hpp"
+
+#include <etl/array.hpp>
+#include <etl/mdspan.hpp>
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+namespace {
+
+template<typename Float, etl::size_t Size>
+[[nodiscard]] auto makeRandomTable() -> etl::array<Float, Size>
+{
+    auto rng   = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist  = etl::uniform_real_distribution<Float>{Float(-1), Float(1)};
+    auto table = etl::array<Float, Size>{};
+    etl::generate(table.begin(), table.end(), [&] { return dist(rng); });
+    return table;
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("math: BufferInterpolation::Masked", "", float, double)
+{
+    using Float = TestType;
+
+    auto const table = makeRandomTable<Float, 64>();
+
+    // Dynamic extent, so the modulo can't be folded into a mask by the compiler.
+    auto const buffer = etl::mdspan{table.data(), etl::dextents<etl::size_t, 1>{table.size()}};
+
+    for (auto readPos = etl::size_t(0); readPos < table.size() * 3; ++readPos) {
+        for (auto const frac : {Float(0), Float(0.25), Float(0.5), Float(0.99)}) {
+            CAPTURE(readPos, frac);
+
+            auto const linear  = grit::BufferInterpolation::Linear{}(buffer, readPos, frac);
+            auto const hermite = grit::BufferInterpolation::Hermite{}(buffer, readPos, frac);
+            REQUIRE(grit::BufferInterpolation::MaskedLinear{}(buffer, readPos, frac) == linear);
+            REQUIRE(grit::BufferInterpolation::MaskedHermite{}(buffer, readPos, frac) == hermite);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("math: BufferInterpolation::Guarded", "", float, double)
+{
+    using Float = TestType;
+
+    STATIC_REQUIRE(grit::bufferGuardPoints<grit::BufferInterpolation::Hermite> == 0);
+    STATIC_REQUIRE(grit::bufferGuardPoints<grit::BufferInterpolation::MaskedHermite> == 0);
+    STATIC_REQUIRE(grit::bufferGuardPoints<grit::BufferInterpolation::GuardedLinear> == 3);
+    STATIC_REQUIRE(grit::bufferGuardPoints<grit::BufferInterpolation::GuardedHermite> == 3);
+
+    auto const table   = makeRandomTable<Float, 48>();
+    auto const guarded = grit::makeGuardedTable(table);
+    REQUIRE(guarded.size() == table.size() + 3);
+
+    auto const buffer        = etl::mdspan{table.data(), etl::extents<etl::size_t, 48>{}};
+    auto const guardedBuffer = etl::mdspan{guarded.data(), etl::extents<etl::size_t, 51>{}};
+
+    for (auto readPos = etl::size_t(0); readPos < table.size(); ++readPos) {
+        for (auto const frac : {Float(0), Float(0.25), Float(0.5), Float(0.99)}) {
+            CAPTURE(readPos, frac);
+
+            auto const linear  = grit::BufferInterpolation::Linear{}(buffer, readPos, frac);
+            auto const hermite = grit::BufferInterpolation::Hermite{}(buffer, readPos, frac);
+            REQUIRE(grit::BufferInterpolation::GuardedLinear{}(guardedBuffer, readPos, frac) == linear);
+            REQUIRE(grit::BufferInterpolation::GuardedHermite{}(guardedBuffer, readPos, frac) == hermite);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("math: BufferInterpolation::Lagrange", "", float, double)
+{
+    using Float = TestType;
+
+    // Third order lagrange reproduces a cubic exactly.
+    auto cubic = [](double x) { return 0.001 * x * x * x - 0.05 * x * x + 0.3 * x - 1.0; };
+
+    auto table = etl::array<Float, 32>{};
+    for (auto i = etl::size_t(0); i < table.size(); ++i) {
+        table[i] = static_cast<Float>(cubic(double(i)));
+    }
+    auto const buffer = etl::mdspan{table.data(), etl::extents<etl::size_t, 32>{}};
+
+    for (auto readPos = etl::size_t(1); readPos < table.size() - 2; ++readPos) {
+        for (auto const frac : {Float(0), Float(0.25), Float(0.5), Float(0.99)}) {
+            CAPTURE(readPos, frac);
+            auto const expected = cubic(double(readPos) + double(frac));
+            auto const lagrange = grit::BufferInterpolation::Lagrange{}(buffer, readPos, frac);
+            REQUIRE_THAT(lagrange, Catch::Matchers::WithinAbs(expected, 1e-4));
+        }
+    }
+}
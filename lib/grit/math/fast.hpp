@@ -0,0 +1,224 @@
+#pragma once
+
+#include <etl/array.hpp>
+#include <etl/bit.hpp>
+#include <etl/concepts.hpp>
+#include <etl/cstdint.hpp>
+#include <etl/limits.hpp>
+#include <etl/numbers.hpp>
+#include <etl/type_traits.hpp>
+
+namespace grit::fast {
+
+/// \brief Error bound of the approximations in grit::fast.
+///
+/// \details Relative error for exp2, exp & pow, absolute error for log2, log,
+/// sin & tanh. pow multiplies the log2 error by the exponent.
+///  - Coarse: 5e-3
+///  - Medium: 1e-4
+///  - Fine:   1e-6, in single precision the rounding of the result dominates
+///
+/// \ingroup grit-math
+enum struct Accuracy : etl::uint8_t
+{
+    Coarse,
+    Medium,
+    Fine,
+};
+
+namespace detail {
+
+template<etl::floating_point Float>
+using FloatBits = etl::conditional_t<sizeof(Float) == 4, etl::uint32_t, etl::uint64_t>;
+
+template<etl::floating_point Float>
+inline constexpr auto mantissaBits = etl::numeric_limits<Float>::digits - 1;
+
+template<etl::floating_point Float>
+inline constexpr auto exponentBias = etl::numeric_limits<Float>::max_exponent - 1;
+
+template<etl::floating_point Float, etl::size_t Size>
+[[nodiscard]] constexpr auto horner(etl::array<double, Size> const& coefficients, Float x) -> Float
+{
+    auto result = static_cast<Float>(coefficients[Size - 1]);
+    for (auto i = Size - 1; i > 0; --i) {
+        result = result * x + static_cast<Float>(coefficients[i - 1]);
+    }
+    return result;
+}
+
+// Minimax fits, 2^x on [0, 1] with relative error
+inline constexpr auto exp2Coarse = etl::array{1.001724130139262, 0.6576375175445516, 0.3371898751238865};
+inline constexpr auto exp2Medium = etl::array{
+    1.0000025918558064,
+    0.6930038507624166,
+    0.24144271810461304,
+    0.0520114806740211,
+    0.013534174641512254,
+};
+inline constexpr auto exp2Fine = etl::array{
+    0.9999999251124695,
+    0.6931530724006751,
+    0.24015362024819822,
+    0.055826314085795095,
+    0.008989340375214774,
+    0.0018775780001241767,
+};
+
+// log2(1 + t) / t on [sqrt(0.5) - 1, sqrt(2) - 1]
+inline constexpr auto log2Coarse = etl::array{1.4451522479186143, -0.7540845223242206, 0.4450722198869754};
+inline constexpr auto log2Medium = etl::array{
+    1.4425779968886014,
+    -0.7202416822665951,
+    0.4866864074574959,
+    -0.39457729912969514,
+    0.25266137683650014,
+};
+inline constexpr auto log2Fine = etl::array{
+    1.4426997267243216,
+    -0.7213758747292057,
+    0.4804650061698913,
+    -0.35896171542417404,
+    0.2972628497443058,
+    -0.2726992228931525,
+    0.17063520765277268,
+};
+
+// sin(2 pi r) / r in powers of r^2 on [0, 0.25]
+inline constexpr auto sinCoarse = etl::array{6.192256849545791, -35.36345136180109};
+inline constexpr auto sinMedium = etl::array{6.281279920042866, -41.0952291753183, 73.58529732988161};
+inline constexpr auto sinFine   = etl::array{
+    6.283164042686588,
+    -41.337142109164375,
+    81.34075876397615,
+    -70.99332485742173,
+};
+
+template<Accuracy A>
+[[nodiscard]] constexpr auto select(auto const& coarse, auto const& medium, auto const& fine) -> auto const&
+{
+    if constexpr (A == Accuracy::Coarse) {
+        return coarse;
+    } else if constexpr (A == Accuracy::Medium) {
+        return medium;
+    } else {
+        return fine;
+    }
+}
+
+}  // namespace detail
+
+/// \brief 2^x, the exponent is built directly in the float's bits.
+/// \details Clamped to the range of normal numbers.
+/// \ingroup grit-math
+template<Accuracy A = Accuracy::Medium, etl::floating_point Float>
+[[nodiscard]] constexpr auto exp2(Float x) -> Float
+{
+    using Bits = detail::FloatBits<Float>;
+
+    constexpr auto bias = detail::exponentBias<Float>;
+    constexpr auto low  = static_cast<Float>(1 - bias);
+    constexpr auto high = static_cast<Float>(bias);
+
+    x = x < low ? low : (x > high ? high : x);
+
+    auto whole = static_cast<int>(x);
+    whole      = static_cast<Float>(whole) > x ? whole - 1 : whole;
+
+    auto const frac  = x - static_cast<Float>(whole);
+    auto const scale = etl::bit_cast<Float>(static_cast<Bits>(whole + bias) << detail::mantissaBits<Float>);
+    auto const& poly = detail::select<A>(detail::exp2Coarse, detail::exp2Medium, detail::exp2Fine);
+    return detail::horner(poly, frac) * scale;
+}
+
+/// \brief log2(x), the exponent is read directly from the float's bits.
+/// \pre x is a positive normal number
+/// \ingroup grit-math
+template<Accuracy A = Accuracy::Medium, etl::floating_point Float>
+[[nodiscard]] constexpr auto log2(Float x) -> Float
+{
+    using Bits = detail::FloatBits<Float>;
+
+    constexpr auto shift        = detail::mantissaBits<Float>;
+    constexpr auto bias         = detail::exponentBias<Float>;
+    constexpr auto mantissaMask = (Bits(1) << shift) - 1;
+
+    auto const bits = etl::bit_cast<Bits>(x);
+    auto exponent   = static_cast<int>(bits >> shift) - bias;
+    auto mantissa   = etl::bit_cast<Float>((bits & mantissaMask) | (static_cast<Bits>(bias) << shift));
+
+    // Centered around 1, the polynomial only covers [sqrt(0.5), sqrt(2)]
+    if (mantissa > static_cast<Float>(etl::numbers::sqrt2)) {
+        mantissa *= Float(0.5);
+        exponent += 1;
+    }
+
+    auto const t    = mantissa - Float(1);
+    auto const poly = detail::horner(detail::select<A>(detail::log2Coarse, detail::log2Medium, detail::log2Fine), t);
+    return static_cast<Float>(exponent) + t * poly;
+}
+
+/// \ingroup grit-math
+template<Accuracy A = Accuracy::Medium, etl::floating_point Float>
+[[nodiscard]] constexpr auto exp(Float x) -> Float
+{
+    return fast::exp2<A>(x * static_cast<Float>(etl::numbers::log2e));
+}
+
+/// \pre x is a positive normal number
+/// \ingroup grit-math
+template<Accuracy A = Accuracy::Medium, etl::floating_point Float>
+[[nodiscard]] constexpr auto log(Float x) -> Float
+{
+    return fast::log2<A>(x) * static_cast<Float>(etl::numbers::ln2);
+}
+
+/// \pre base is a positive normal number
+/// \ingroup grit-math
+template<Accuracy A = Accuracy::Medium, etl::floating_point Float>
+[[nodiscard]] constexpr auto pow(Float base, Float exponent) -> Float
+{
+    return fast::exp2<A>(exponent * fast::log2<A>(base));
+}
+
+/// \brief sin(2 pi x), one period per unit like an oscillator's phase.
+/// \pre |x| < 2^31, the floor is a 32-bit conversion, a single instruction on the Cortex-M7
+/// \ingroup grit-math
+template<Accuracy A = Accuracy::Medium, etl::floating_point Float>
+[[nodiscard]] constexpr auto sin2pi(Float x) -> Float
+{
+    // Reduce to [-0.5, 0.5], then mirror onto [-0.25, 0.25] where the polynomial lives.
+    auto const shifted = x + Float(0.5);
+    auto whole         = static_cast<etl::int32_t>(shifted);
+    whole              = static_cast<Float>(whole) > shifted ? whole - 1 : whole;
+
+    auto r = x - static_cast<Float>(whole);
+    r      = r > Float(+0.25) ? Float(+0.5) - r : r;
+    r      = r < Float(-0.25) ? Float(-0.5) - r : r;
+
+    auto const poly = detail::horner(detail::select<A>(detail::sinCoarse, detail::sinMedium, detail::sinFine), r * r);
+    return r * poly;
+}
+
+/// \ingroup grit-math
+template<Accuracy A = Accuracy::Medium, etl::floating_point Float>
+[[nodiscard]] constexpr auto sin(Float x) -> Float
+{
+    return fast::sin2pi<A>(x * static_cast<Float>(etl::numbers::inv_pi * 0.5));
+}
+
+/// \brief tanh(x) as (e^2x - 1) / (e^2x + 1), the error is below the one of exp.
+/// \ingroup grit-math
+template<Accuracy A = Accuracy::Medium, etl::floating_point Float>
+[[nodiscard]] constexpr auto tanh(Float x) -> Float
+{
+    // Normalized by the approximation at 0, so tanh(0) is exactly 0 & the curve has no step at the origin.
+    constexpr auto one = fast::exp2<A>(Float(0));
+
+    auto const absX = x < Float(0) ? -x : x;
+    auto const e    = fast::exp<A>(absX * Float(2));
+    auto const y    = (e - one) / (e + one);
+    return x < Float(0) ? -y : y;
+}
+
+}  // namespace grit::fast
@@ -0,0 +1,134 @@
+#include "fast.hpp"
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <etl/cmath.hpp>
+#include <etl/numbers.hpp>
+
+namespace {
+
+template<typename Float>
+auto maxError(auto approx, auto exact, Float min, Float max, bool relative) -> double
+{
+    auto error = 0.0;
+    for (auto i = 0; i <= 10'000; ++i) {
+        auto const x    = static_cast<Float>(min + (max - min) * static_cast<Float>(i) / Float(10'000));
+        auto const want = static_cast<double>(exact(x));
+        auto const diff = etl::abs(static_cast<double>(approx(x)) - want);
+        error           = etl::max(error, relative ? diff / etl::abs(want) : diff);
+    }
+    return error;
+}
+
+// Single precision rounds the result itself, Fine is only reached in double.
+template<typename Float>
+constexpr auto bound(grit::fast::Accuracy accuracy) -> double
+{
+    switch (accuracy) {
+        case grit::fast::Accuracy::Coarse: return 5e-3;
+        case grit::fast::Accuracy::Medium: return 1e-4;
+        case grit::fast::Accuracy::Fine: return etl::same_as<Float, float> ? 1e-5 : 1e-6;
+    }
+    return 0.0;
+}
+
+template<grit::fast::Accuracy A, typename Float>
+auto checkTier() -> void
+{
+    using grit::fast::Accuracy;
+
+    auto const exp2 = maxError(
+        [](Float x) { return grit::fast::exp2<A>(x); },
+        [](Float x) { return etl::exp2(static_cast<double>(x)); },
+        Float(-30),
+        Float(30),
+        true
+    );
+    auto const exp = maxError(
+        [](Float x) { return grit::fast::exp<A>(x); },
+        [](Float x) { return etl::exp(static_cast<double>(x)); },
+        Float(-10),
+        Float(10),
+        true
+    );
+    auto const log2 = maxError(
+        [](Float x) { return grit::fast::log2<A>(x); },
+        [](Float x) { return etl::log2(static_cast<double>(x)); },
+        Float(1e-3),
+        Float(16),
+        false
+    );
+    auto const sin = maxError(
+        [](Float x) { return grit::fast::sin<A>(x); },
+        [](Float x) { return etl::sin(static_cast<double>(x)); },
+        Float(-10),
+        Float(10),
+        false
+    );
+    auto const sin2pi = maxError(
+        [](Float x) { return grit::fast::sin2pi<A>(x); },
+        [](Float x) { return etl::sin(static_cast<double>(x) * 2.0 * etl::numbers::pi); },
+        Float(0),
+        Float(1),
+        false
+    );
+    auto const tanh = maxError(
+        [](Float x) { return grit::fast::tanh<A>(x); },
+        [](Float x) { return etl::tanh(static_cast<double>(x)); },
+        Float(-10),
+        Float(10),
+        false
+    );
+
+    auto const limit = bound<Float>(A);
+    REQUIRE(exp2 < limit);
+    REQUIRE(exp < limit);
+    REQUIRE(log2 < limit);
+    REQUIRE(sin < limit);
+    REQUIRE(sin2pi < limit);
+    REQUIRE(tanh < limit);
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("math: fast", "", float, double)
+{
+    using Float = TestType;
+    using grit::fast::Accuracy;
+
+    SECTION("coarse") { checkTier<Accuracy::Coarse, Float>(); }
+    SECTION("medium") { checkTier<Accuracy::Medium, Float>(); }
+    SECTION("fine") { checkTier<Accuracy::Fine, Float>(); }
+
+    SECTION("exact points")
+    {
+        REQUIRE(grit::fast::log2(Float(1)) == Float(0));
+        REQUIRE(grit::fast::sin2pi(Float(0)) == Float(0));
+        REQUIRE(grit::fast::sin2pi(Float(0.5)) == Float(0));
+        REQUIRE(grit::fast::tanh(Float(0)) == Float(0));
+        REQUIRE(grit::fast::tanh(Float(100)) == Float(1));
+        REQUIRE(grit::fast::tanh(Float(-100)) == Float(-1));
+    }
+
+    SECTION("symmetry")
+    {
+        for (auto x : {Float(0.1), Float(0.7), Float(2.5)}) {
+            REQUIRE(grit::fast::sin(-x) == -grit::fast::sin(x));
+            REQUIRE(grit::fast::tanh(-x) == -grit::fast::tanh(x));
+        }
+    }
+
+    SECTION("pow")
+    {
+        REQUIRE_THAT(grit::fast::pow(Float(2), Float(10)), Catch::Matchers::WithinRel(1024.0, 1e-3));
+        REQUIRE_THAT(grit::fast::pow(Float(10), Float(-0.5)), Catch::Matchers::WithinRel(0.316228, 1e-3));
+        REQUIRE_THAT(grit::fast::pow(Float(0.5), Float(3)), Catch::Matchers::WithinRel(0.125, 1e-3));
+    }
+
+    SECTION("clamped range")
+    {
+        REQUIRE(grit::fast::exp2(Float(-10'000)) > Float(0));
+        REQUIRE(grit::fast::exp2(Float(+10'000)) < etl::numeric_limits<Float>::infinity());
+    }
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <etl/algorithm.hpp>
+#include <etl/concepts.hpp>
+#include <etl/cstdint.hpp>
+#include <etl/limits.hpp>
+#include <etl/type_traits.hpp>
+
+namespace grit {
+
+/// \brief Signed fractional fixed point number in [-1, 1).
+///
+/// \details All but the sign bit are fractional bits, Q15 for 16-bit and Q31
+/// for 32-bit storage. Conversions from float round to nearest, addition,
+/// subtraction & multiplication saturate instead of wrapping, so -1 * -1
+/// yields the largest representable value.
+///
+/// \ingroup grit-math
+template<etl::signed_integral Int>
+struct FixedPoint
+{
+    using StorageType     = Int;
+    using AccumulatorType = etl::conditional_t<sizeof(Int) <= 2, etl::int32_t, etl::int64_t>;
+
+    static constexpr auto fractionalBits = etl::numeric_limits<Int>::digits;
+
+    constexpr FixedPoint() = default;
+
+    [[nodiscard]] static constexpr auto fromRaw(Int raw) -> FixedPoint;
+
+    template<etl::floating_point Float>
+    [[nodiscard]] static constexpr auto fromFloat(Float x) -> FixedPoint;
+
+    /// Rounds & saturates a value with fractionalBits + shift fractional bits.
+    [[nodiscard]] static constexpr auto fromAccumulator(AccumulatorType acc, int shift = 0) -> FixedPoint;
+
+    [[nodiscard]] constexpr auto raw() const -> Int { return _raw; }
+
+    template<etl::floating_point Float>
+    [[nodiscard]] constexpr auto toFloat() const -> Float;
+
+    friend constexpr auto operator-(FixedPoint x) -> FixedPoint { return saturate(-AccumulatorType(x._raw)); }
+
+    friend constexpr auto operator+(FixedPoint lhs, FixedPoint rhs) -> FixedPoint
+    {
+        return saturate(AccumulatorType(lhs._raw) + AccumulatorType(rhs._raw));
+    }
+
+    friend constexpr auto operator-(FixedPoint lhs, FixedPoint rhs) -> FixedPoint
+    {
+        return saturate(AccumulatorType(lhs._raw) - AccumulatorType(rhs._raw));
+    }
+
+    friend constexpr auto operator*(FixedPoint lhs, FixedPoint rhs) -> FixedPoint
+    {
+        return fromAccumulator(AccumulatorType(lhs._raw) * AccumulatorType(rhs._raw), fractionalBits);
+    }
+
+    friend constexpr auto operator+=(FixedPoint& lhs, FixedPoint rhs) -> FixedPoint& { return lhs = lhs + rhs; }
+
+    friend constexpr auto operator-=(FixedPoint& lhs, FixedPoint rhs) -> FixedPoint& { return lhs = lhs - rhs; }
+
+    friend constexpr auto operator*=(FixedPoint& lhs, FixedPoint rhs) -> FixedPoint& { return lhs = lhs * rhs; }
+
+    friend constexpr auto operator==(FixedPoint lhs, FixedPoint rhs) -> bool = default;
+
+    friend constexpr auto operator<=>(FixedPoint lhs, FixedPoint rhs) = default;
+
+private:
+    [[nodiscard]] static constexpr auto saturate(AccumulatorType x) -> FixedPoint;
+
+    Int _raw{0};
+};
+
+/// \ingroup grit-math
+using Q15 = FixedPoint<etl::int16_t>;
+
+/// \ingroup grit-math
+using Q31 = FixedPoint<etl::int32_t>;
+
+template<etl::signed_integral Int>
+constexpr auto FixedPoint<Int>::fromRaw(Int raw) -> FixedPoint
+{
+    auto result = FixedPoint{};
+    result._raw = raw;
+    return result;
+}
+
+template<etl::signed_integral Int>
+template<etl::floating_point Float>
+constexpr auto FixedPoint<Int>::fromFloat(Float x) -> FixedPoint
+{
+    // In double, float can't represent the largest Q31 value.
+    auto const scaled  = static_cast<double>(x) * static_cast<double>(AccumulatorType(1) << fractionalBits);
+    auto const low     = static_cast<double>(etl::numeric_limits<Int>::min());
+    auto const high    = static_cast<double>(etl::numeric_limits<Int>::max());
+    auto const clamped = etl::clamp(scaled + (scaled < 0.0 ? -0.5 : 0.5), low, high);
+    return fromRaw(static_cast<Int>(clamped));
+}
+
+template<etl::signed_integral Int>
+constexpr auto FixedPoint<Int>::fromAccumulator(AccumulatorType acc, int shift) -> FixedPoint
+{
+    if (shift <= 0) {
+        return saturate(acc);
+    }
+    auto const half = AccumulatorType(1) << (shift - 1);
+    return saturate((acc + half) >> shift);
+}
+
+template<etl::signed_integral Int>
+template<etl::floating_point Float>
+constexpr auto FixedPoint<Int>::toFloat() const -> Float
+{
+    return static_cast<Float>(static_cast<double>(_raw) / static_cast<double>(AccumulatorType(1) << fractionalBits));
+}
+
+template<etl::signed_integral Int>
+constexpr auto FixedPoint<Int>::saturate(AccumulatorType x) -> FixedPoint
+{
+    auto const low  = AccumulatorType(etl::numeric_limits<Int>::min());
+    auto const high = AccumulatorType(etl::numeric_limits<Int>::max());
+    return fromRaw(static_cast<Int>(etl::clamp(x, low, high)));
+}
+
+}  // namespace grit
@@ -0,0 +1,46 @@
+#include "fixed_point.hpp"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+TEMPLATE_TEST_CASE("math: FixedPoint", "", grit::Q15, grit::Q31)
+{
+    using Fixed = TestType;
+    using Int   = typename Fixed::StorageType;
+
+    static constexpr auto max = etl::numeric_limits<Int>::max();
+    static constexpr auto min = etl::numeric_limits<Int>::min();
+
+    STATIC_REQUIRE(Fixed::fromFloat(0.5).raw() == Int(Int(1) << (Fixed::fractionalBits - 1)));
+    STATIC_REQUIRE(Fixed::fromFloat(-1.0).raw() == min);
+    STATIC_REQUIRE(Fixed::fromFloat(1.0).raw() == max);
+    STATIC_REQUIRE(Fixed::fromFloat(-4.0F).raw() == min);
+
+    REQUIRE(Fixed::fromFloat(0.25).template toFloat<double>() == 0.25);
+    REQUIRE(Fixed::fromFloat(-0.3).template toFloat<double>() == Catch::Approx(-0.3).margin(1e-4));
+
+    SECTION("saturating arithmetic")
+    {
+        auto const half = Fixed::fromFloat(0.5);
+        REQUIRE((half + half).raw() == max);
+        REQUIRE((-half - half - half).raw() == min);
+        REQUIRE((-Fixed::fromRaw(min)).raw() == max);
+        REQUIRE((Fixed::fromRaw(min) * Fixed::fromRaw(min)).raw() == max);
+        REQUIRE((half * half) == Fixed::fromFloat(0.25));
+        REQUIRE((half * -half) == Fixed::fromFloat(-0.25));
+    }
+
+    SECTION("rounding")
+    {
+        // 3 * 0.5 ulp rounds away from zero
+        REQUIRE((Fixed::fromRaw(3) * Fixed::fromFloat(0.5)).raw() == 2);
+        REQUIRE(Fixed::fromAccumulator(7, 2).raw() == 2);
+        REQUIRE(Fixed::fromAccumulator(5, 2).raw() == 1);
+    }
+
+    SECTION("comparison")
+    {
+        REQUIRE(Fixed::fromFloat(0.1) < Fixed::fromFloat(0.2));
+        REQUIRE(Fixed::fromFloat(-0.1) != Fixed::fromFloat(0.1));
+    }
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <grit/math/fast.hpp>
+
 #include <etl/algorithm.hpp>
 #include <etl/cmath.hpp>
 #include <etl/concepts.hpp>
@@ -25,6 +27,30 @@ auto toDecibels(Float gain, Float minusInfinityDb = defaultMinusInfinityDb<Float
                           : minusInfinityDb;
 }
 
+namespace fast {
+
+/// \brief fromDecibels() through fast::exp2, same handling of minusInfinityDb.
+/// \ingroup grit-unit
+template<Accuracy A = Accuracy::Medium, etl::floating_point Float>
+constexpr auto fromDecibels(Float decibels, Float minusInfinityDb = defaultMinusInfinityDb<Float>) -> Float
+{
+    // 10^(dB/20) == 2^(dB * log2(10) / 20)
+    constexpr auto scale = static_cast<Float>(0.16609640474436813);
+    return decibels > minusInfinityDb ? fast::exp2<A>(decibels * scale) : Float();
+}
+
+/// \brief toDecibels() through fast::log2, same handling of minusInfinityDb.
+/// \ingroup grit-unit
+template<Accuracy A = Accuracy::Medium, etl::floating_point Float>
+constexpr auto toDecibels(Float gain, Float minusInfinityDb = defaultMinusInfinityDb<Float>) -> Float
+{
+    // 20 * log10(x) == 20 * log10(2) * log2(x)
+    constexpr auto scale = static_cast<Float>(6.020599913279624);
+    return gain > Float() ? etl::max(minusInfinityDb, fast::log2<A>(gain) * scale) : minusInfinityDb;
+}
+
+}  // namespace fast
+
 /// \ingroup grit-unit
 template<etl::floating_point Float>
 struct Decibels
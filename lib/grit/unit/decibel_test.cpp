@@ -31,3 +31,19 @@ TEMPLATE_TEST_CASE("unit: Decibels", "", float, double)
     REQUIRE((grit::Decibels{Float(1)} / Float(2)).value() == Catch::Approx(0.5));
     REQUIRE((grit::Decibels{Float(1)} * Float(2)).value() == Catch::Approx(2));
 }
+
+TEMPLATE_TEST_CASE("unit: fast::toDecibels/fast::fromDecibels", "", float, double)
+{
+    using Float = TestType;
+
+    auto const infinity = grit::defaultMinusInfinityDb<Float>;
+
+    REQUIRE(grit::fast::toDecibels(Float(0)) == Catch::Approx(infinity));
+    REQUIRE(grit::fast::toDecibels(Float(0.00000001)) == Catch::Approx(infinity));
+    REQUIRE(grit::fast::fromDecibels(infinity) == Catch::Approx(Float(0)));
+
+    for (auto db = Float(-90); db <= Float(24); db += Float(0.25)) {
+        REQUIRE(grit::fast::fromDecibels(db) == Catch::Approx(grit::fromDecibels(db)).epsilon(1e-4));
+        REQUIRE(grit::fast::toDecibels(grit::fromDecibels(db)) == Catch::Approx(db).margin(1e-3));
+    }
+}
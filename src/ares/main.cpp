@@ -1,3 +1,6 @@
+#include <common/stats.hpp>
+
+#include <grit/core/callback_load_monitor.hpp>
 #include <grit/eurorack/ares.hpp>
 
 #include <etl/linalg.hpp>
@@ -9,17 +12,24 @@ namespace ares {
 static constexpr auto blockSize  = 32U;
 static constexpr auto sampleRate = 96'000.0F;
 
+// Prints the callback load & the cycles per processing stage over the usb serial once a second.
+static constexpr auto printStats = false;
+
 auto processor = grit::Ares{};
 auto patch     = daisy::patch_sm::DaisyPatchSM{};
 auto button    = daisy::Switch{};
 auto toggle    = daisy::Switch{};
 
+auto loadMonitor = grit::CallbackLoadMonitor{};
+
 auto audioCallback(
     daisy::AudioHandle::InterleavingInputBuffer in,
     daisy::AudioHandle::InterleavingOutputBuffer out,
     size_t size
 ) -> void
 {
+    loadMonitor.begin();
+
     patch.ProcessAllControls();
     button.Debounce();
     toggle.Debounce();
@@ -42,6 +52,8 @@ auto audioCallback(
     etl::linalg::copy(input, output);
 
     processor.process(output, controls);
+
+    loadMonitor.end();
 }
 
 }  // namespace ares
@@ -52,11 +64,14 @@ auto main() -> int
     ares::button.Init(ares::patch.B7);
     ares::toggle.Init(ares::patch.B8);
 
+    grit::CycleCounter::enable();
+
     ares::processor.prepare(ares::sampleRate, ares::blockSize);
+    ares::loadMonitor.prepare(ares::sampleRate, ares::blockSize, static_cast<float>(daisy::System::GetSysClkFreq()));
 
     ares::patch.SetAudioSampleRate(ares::sampleRate);
     ares::patch.SetAudioBlockSize(ares::blockSize);
     ares::patch.StartAudio(ares::audioCallback);
 
-    while (true) {}
+    common::runMainLoop<ares::printStats>(ares::processor, ares::loadMonitor);
 }
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <grit/core/callback_load_monitor.hpp>
+#include <grit/core/profiler.hpp>
+
+#include <etl/cstddef.hpp>
+
+#include <daisy_patch_sm.h>
+
+namespace common {
+
+/// Prints the callback load & the cycles per profiler zone over the usb serial.
+template<typename Processor, typename Clock>
+auto printStats(Processor& processor, grit::CallbackLoadMonitor<Clock>& loadMonitor) -> void
+{
+    daisy::patch_sm::DaisyPatchSM::PrintLine(
+        "Load: %3d %% - Peak: %3d %% - Overruns: %u",
+        static_cast<int>(loadMonitor.load() * 100.0F),
+        static_cast<int>(loadMonitor.takePeak() * 100.0F),
+        static_cast<unsigned>(loadMonitor.overruns())
+    );
+    processor.profiler().drain([](etl::size_t zone, grit::ProfileStats const& stats) {
+        daisy::patch_sm::DaisyPatchSM::PrintLine(
+            "%12s Calls: %6u - Min: %6u - Average: %6u - Max: %6u cycles",
+            Processor::profileZoneNames[zone],
+            static_cast<unsigned>(stats.calls),
+            static_cast<unsigned>(stats.min),
+            static_cast<unsigned>(stats.average()),
+            static_cast<unsigned>(stats.max)
+        );
+    });
+}
+
+/// Idle loop of the firmware mains, the audio runs in the callback.
+/// With PrintStats it calls printStats() once a second.
+template<bool PrintStats, typename Processor, typename Clock>
+[[noreturn]] auto runMainLoop(Processor& processor, grit::CallbackLoadMonitor<Clock>& loadMonitor) -> void
+{
+    if constexpr (PrintStats) {
+        daisy::patch_sm::DaisyPatchSM::StartLog(false);
+    }
+
+    while (true) {
+        if constexpr (PrintStats) {
+            daisy::System::Delay(1'000);
+            printStats(processor, loadMonitor);
+        }
+    }
+}
+
+}  // namespace common
@@ -1,3 +1,6 @@
+#include <common/stats.hpp>
+
+#include <grit/core/callback_load_monitor.hpp>
 #include <grit/eurorack/kyma.hpp>
 
 #include <etl/linalg.hpp>
@@ -9,17 +12,24 @@ namespace kyma {
 static constexpr auto blockSize  = 16U;
 static constexpr auto sampleRate = 96'000.0F;
 
+// Prints the callback load & the cycles per processing stage over the usb serial once a second.
+static constexpr auto printStats = false;
+
 auto patch     = daisy::patch_sm::DaisyPatchSM{};
 auto toggle    = daisy::Switch{};
 auto button    = daisy::Switch{};
 auto processor = grit::Kyma{};
 
+auto loadMonitor = grit::CallbackLoadMonitor{};
+
 auto audioCallback(
     daisy::AudioHandle::InterleavingInputBuffer in,
     daisy::AudioHandle::InterleavingOutputBuffer out,
     size_t size
 ) -> void
 {
+    loadMonitor.begin();
+
     patch.ProcessAllControls();
     toggle.Debounce();
     button.Debounce();
@@ -44,6 +54,8 @@ auto audioCallback(
 
     auto const env = processor.process(output, controls);
     patch.WriteCvOut(daisy::patch_sm::CV_OUT_2, env * 5.0F);
+
+    loadMonitor.end();
 }
 
 }  // namespace kyma
@@ -55,11 +67,14 @@ auto main() -> int
     kyma::toggle.Init(daisy::patch_sm::DaisyPatchSM::B8);
     kyma::button.Init(daisy::patch_sm::DaisyPatchSM::B7);
 
+    grit::CycleCounter::enable();
+
     kyma::processor.prepare(kyma::sampleRate, kyma::blockSize);
+    kyma::loadMonitor.prepare(kyma::sampleRate, kyma::blockSize, static_cast<float>(daisy::System::GetSysClkFreq()));
 
     kyma::patch.SetAudioSampleRate(kyma::sampleRate);
     kyma::patch.SetAudioBlockSize(kyma::blockSize);
     kyma::patch.StartAudio(kyma::audioCallback);
 
-    while (true) {}
+    common::runMainLoop<kyma::printStats>(kyma::processor, kyma::loadMonitor);
 }
@@ -1,3 +1,6 @@
+#include <common/stats.hpp>
+
+#include <grit/core/callback_load_monitor.hpp>
 #include <grit/eurorack/poseidon.hpp>
 
 #include <etl/linalg.hpp>
@@ -9,17 +12,24 @@ namespace poseidon {
 static constexpr auto blockSize  = 32U;
 static constexpr auto sampleRate = 96'000.0F;
 
+// Prints the callback load & the cycles per processing stage over the usb serial once a second.
+static constexpr auto printStats = false;
+
 auto processor = grit::Poseidon{};
 auto patch     = daisy::patch_sm::DaisyPatchSM{};
 auto button    = daisy::Switch{};
 auto toggle    = daisy::Switch{};
 
+auto loadMonitor = grit::CallbackLoadMonitor{};
+
 auto audioCallback(
     daisy::AudioHandle::InterleavingInputBuffer in,
     daisy::AudioHandle::InterleavingOutputBuffer out,
     size_t size
 ) -> void
 {
+    loadMonitor.begin();
+
     patch.ProcessAllControls();
     button.Debounce();
     toggle.Debounce();
@@ -55,6 +65,8 @@ auto audioCallback(
     patch.WriteCvOut(daisy::patch_sm::CV_OUT_BOTH, cvOut.envelope * 5.0F);
     patch.gate_out_1.Write(cvOut.gate1);
     patch.gate_out_2.Write(cvOut.gate2);
+
+    loadMonitor.end();
 }
 
 }  // namespace poseidon
@@ -65,11 +77,18 @@ auto main() -> int
     poseidon::button.Init(daisy::patch_sm::DaisyPatchSM::B7);
     poseidon::toggle.Init(daisy::patch_sm::DaisyPatchSM::B8);
 
+    grit::CycleCounter::enable();
+
     poseidon::processor.prepare(poseidon::sampleRate, poseidon::blockSize);
+    poseidon::loadMonitor.prepare(
+        poseidon::sampleRate,
+        poseidon::blockSize,
+        static_cast<float>(daisy::System::GetSysClkFreq())
+    );
 
     poseidon::patch.SetAudioSampleRate(poseidon::sampleRate);
     poseidon::patch.SetAudioBlockSize(poseidon::blockSize);
     poseidon::patch.StartAudio(poseidon::audioCallback);
 
-    while (true) {}
+    common::runMainLoop<poseidon::printStats>(poseidon::processor, poseidon::loadMonitor);
 }
@@ -0,0 +1,796 @@
+#pragma once
+
+#include <grit/audio.hpp>
+#include <grit/core/benchmark.hpp>
+#include <grit/fft.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/concepts.hpp>
+#include <etl/linalg.hpp>
+#include <etl/numeric.hpp>
+#include <etl/random.hpp>
+#include <etl/span.hpp>
+
+namespace bench {
+
+/// The callback every firmware runs with. Used for the "percent of budget" column.
+inline constexpr auto budgetSampleRate = 96'000.0;
+inline constexpr auto budgetBlockSize  = 32;
+
+/// Time available for one audio callback in nanoseconds.
+inline constexpr auto budgetNanoseconds = double(budgetBlockSize) / budgetSampleRate * 1e9;
+
+enum struct Kind
+{
+    Audio,
+    FFT,
+};
+
+struct Result
+{
+    char const* name{""};
+    Kind kind{Kind::Audio};
+    int size{0};  // Block size for audio, transform size for fft
+    int runs{0};
+
+    double average{0};  // Nanoseconds per call
+    double min{0};      // Nanoseconds per call
+    double max{0};      // Nanoseconds per call
+
+    /// For audio benchmarks a sample is one stereo frame.
+    [[nodiscard]] auto nanosecondsPerSample() const -> double { return average / double(size); }
+
+    /// Cost of one call relative to a 32 sample block at 96 kHz.
+    [[nodiscard]] auto budgetPercent() const -> double { return average / budgetNanoseconds * 100.0; }
+
+    /// Roundtrip (forward + backward) flop estimate. Only meaningful for Kind::FFT.
+    [[nodiscard]] auto mflops() const -> double
+    {
+        auto const n = double(size);
+        return 5.0 * n * etl::log2(n) * 2.0 / (average * 1e-3);
+    }
+};
+
+template<typename RealOrComplex, unsigned N>
+[[nodiscard]] auto makeNoise(auto& rng) -> etl::array<RealOrComplex, N>
+{
+    if constexpr (etl::floating_point<RealOrComplex>) {
+        using Float = RealOrComplex;
+        auto buf    = etl::array<Float, N>{};
+        auto dist   = etl::uniform_real_distribution<Float>{Float(-1.0), Float(1.0)};
+        auto gen    = [&rng, &dist] { return dist(rng); };
+        etl::generate(buf.begin(), buf.end(), gen);
+        return buf;
+    } else {
+        using Float = RealOrComplex::value_type;
+        auto buf    = etl::array<RealOrComplex, N>{};
+        auto dist   = etl::uniform_real_distribution<Float>{Float(-1.0), Float(1.0)};
+        auto gen    = [&rng, &dist] { return RealOrComplex{dist(rng), dist(rng)}; };
+        etl::generate(buf.begin(), buf.end(), gen);
+        return buf;
+    }
+};
+
+template<typename Values>
+auto summarize(Result& result, Values const& runs) -> void
+{
+    result.runs    = static_cast<int>(runs.size());
+    result.average = etl::reduce(runs.begin(), runs.end(), 0.0) / static_cast<double>(runs.size());
+    result.min     = *etl::min_element(runs.begin(), runs.end());
+    result.max     = *etl::max_element(runs.begin(), runs.end());
+}
+
+/// \tparam Clock Needs a static now() function returning nanoseconds as double.
+template<int N, typename Clock, typename Benchmark>
+[[nodiscard]] auto fftBench(char const* name, Benchmark bench) -> Result
+{
+    auto runs = etl::array<double, N>{};
+
+    bench();
+    bench();
+    bench();
+
+    for (auto i{0U}; i < N; ++i) {
+        auto const start = Clock::now();
+        bench();
+        auto const stop = Clock::now();
+
+        runs[i] = stop - start;
+    }
+
+    auto result = Result{.name = name, .kind = Kind::FFT, .size = static_cast<int>(bench.size())};
+    summarize(result, runs);
+    return result;
+}
+
+/// \tparam Clock Needs a static now() function returning nanoseconds as double.
+template<int BlockSize, int Runs, typename Clock, typename Benchmark>
+[[nodiscard]] auto audioBench(char const* name, Benchmark bench) -> Result
+{
+    auto runs = etl::array<double, Runs>{};
+
+    auto rng              = etl::xoshiro128plusplus{14342};
+    auto const noiseLeft  = makeNoise<float, BlockSize>(rng);
+    auto const noiseRight = makeNoise<float, BlockSize>(rng);
+
+    auto const fillWithNoise = [&](auto& block) {
+        for (auto i{0U}; i < block.extent(1); ++i) {
+            block(0, i) = noiseLeft[i];
+            block(1, i) = noiseRight[i];
+        }
+    };
+
+    auto buffer = etl::array<float, BlockSize * 2>{};
+    auto block  = grit::StereoBlock<float>{buffer.data(), buffer.size() / 2};
+
+    for (auto i{0U}; i < Runs; ++i) {
+        fillWithNoise(block);
+
+        auto const start = Clock::now();
+        bench(block);
+        auto const stop = Clock::now();
+
+        grit::doNotOptimize(buffer.front());
+        grit::doNotOptimize(buffer.back());
+
+        runs[i] = stop - start;
+    }
+
+    auto result = Result{.name = name, .kind = Kind::Audio, .size = BlockSize};
+    summarize(result, runs);
+    return result;
+}
+
+struct c2c_dit2_v3
+{
+    c2c_dit2_v3() = default;
+
+    template<etl::linalg::inout_vector Vec>
+    auto operator()(Vec x, auto const& twiddles) const noexcept -> void
+    {
+        auto const size  = x.size();
+        auto const order = grit::ilog2(size);
+
+        {
+            // stage 0
+            static constexpr auto const stage_length = 1;  // grit::ipow<2>(0)
+            static constexpr auto const stride       = 2;  // grit::ipow<2>(0 + 1)
+
+            for (auto k{0}; k < static_cast<int>(size); k += stride) {
+                auto const i1 = k;
+                auto const i2 = k + stage_length;
+
+                auto const temp = x(i1) + x(i2);
+                x(i2)           = x(i1) - x(i2);
+                x(i1)           = temp;
+            }
+        }
+
+        for (auto stage{1ULL}; stage < order; ++stage) {
+
+            auto const stage_length = grit::ipow<2ULL>(stage);
+            auto const stride       = grit::ipow<2ULL>(stage + 1);
+            auto const tw_stride    = grit::ipow<2ULL>(order - stage - 1ULL);
+
+            for (auto k{0ULL}; k < size; k += stride) {
+                for (auto pair{0ULL}; pair < stage_length; ++pair) {
+                    auto const tw = twiddles(pair * tw_stride);
+
+                    auto const i1 = k + pair;
+                    auto const i2 = k + pair + stage_length;
+
+                    auto const temp = x(i1) + tw * x(i2);
+                    x(i2)           = x(i1) - tw * x(i2);
+                    x(i1)           = temp;
+                }
+            }
+        }
+    }
+};
+
+template<typename Float, int N, typename Kernel>
+struct ComplexRoundtrip
+{
+    ComplexRoundtrip() = default;
+
+    static constexpr auto size() { return N; }
+
+    auto operator()() -> void
+    {
+        auto x      = etl::mdspan<etl::complex<Float>, etl::extents<etl::size_t, N>>{_buf.data()};
+        auto w      = etl::mdspan<etl::complex<Float> const, etl::extents<etl::size_t, N / 2>>{_tw.data()};
+        auto kernel = Kernel{};
+
+        kernel(x, w);
+        kernel(x, etl::linalg::conjugated(w));
+        etl::linalg::scale(Float(1) / Float(N), x);
+
+        grit::doNotOptimize(_buf.front());
+        grit::doNotOptimize(_buf.back());
+    }
+
+private:
+    etl::array<etl::complex<Float>, N / 2> _tw{grit::fft::detail::makeTwiddles<Float, N>()};
+    etl::array<etl::complex<Float>, N> _buf{[] {
+        auto rng = etl::xoshiro128plusplus{42};
+        return makeNoise<etl::complex<Float>, N>(rng);
+    }()};
+};
+
+template<typename Complex, etl::size_t Size>
+using ComplexPlanRadix4 = grit::fft::ComplexPlan<Complex, Size, grit::fft::Radix4Kernel>;
+
+template<typename Complex, etl::size_t Size>
+using ComplexPlanSplitRadix = grit::fft::ComplexPlan<Complex, Size, grit::fft::SplitRadixKernel>;
+
+template<typename Complex, etl::size_t Size>
+using ComplexPlanBitReversed = grit::fft::ComplexPlanBitReversed<Complex, Size>;
+
+template<typename Float, int N, template<typename, etl::size_t> typename Plan = grit::fft::ComplexPlanV2>
+struct StaticComplexRoundtrip
+{
+    StaticComplexRoundtrip() = default;
+
+    static constexpr auto size() { return N; }
+
+    auto operator()() -> void
+    {
+        auto x = etl::mdspan{_buf.data(), etl::extents<etl::size_t, N>{}};
+        _plan(x, grit::fft::Direction::Forward);
+        _plan(x, grit::fft::Direction::Backward);
+        etl::linalg::scale(Float(1) / Float(N), x);
+
+        grit::doNotOptimize(_buf.front());
+        grit::doNotOptimize(_buf.back());
+    }
+
+private:
+    Plan<etl::complex<Float>, N> _plan{};
+    etl::array<etl::complex<Float>, N> _buf{[] {
+        auto rng = etl::xoshiro128plusplus{42};
+        return makeNoise<etl::complex<Float>, N>(rng);
+    }()};
+};
+
+/// The block exponent would drift over repeated roundtrips, so every run starts from the same noise.
+template<int N>
+struct ComplexRoundtripQ15
+{
+    ComplexRoundtripQ15() = default;
+
+    static constexpr auto size() { return N; }
+
+    auto operator()() -> void
+    {
+        _buf   = _noise;
+        auto x = etl::mdspan{_buf.data(), etl::extents<etl::size_t, N>{}};
+
+        auto exponent = _plan(x, grit::fft::Direction::Forward);
+        exponent += _plan(x, grit::fft::Direction::Backward);
+
+        grit::doNotOptimize(exponent);
+        grit::doNotOptimize(_buf.front());
+        grit::doNotOptimize(_buf.back());
+    }
+
+private:
+    grit::fft::ComplexPlanQ15<N> _plan{};
+    etl::array<grit::fft::PackedComplexQ15, N> _buf{};
+    etl::array<grit::fft::PackedComplexQ15, N> _noise{[] {
+        auto rng   = etl::xoshiro128plusplus{42};
+        auto noise = makeNoise<etl::complex<float>, N>(rng);
+        auto buf   = etl::array<grit::fft::PackedComplexQ15, N>{};
+        etl::transform(noise.begin(), noise.end(), buf.begin(), [](auto z) {
+            return grit::fft::packComplexQ15(z);
+        });
+        return buf;
+    }()};
+};
+
+template<typename Float, int N>
+struct RealRoundtrip
+{
+    RealRoundtrip() = default;
+
+    static constexpr auto size() { return N; }
+
+    auto operator()() -> void
+    {
+        auto x    = etl::mdspan{_buf.data(), etl::extents<etl::size_t, N>{}};
+        auto bins = etl::mdspan{_bins.data(), etl::extents<etl::size_t, N / 2 + 1>{}};
+        _plan(x, bins);
+        _plan(bins, x);
+        etl::linalg::scale(Float(1) / Float(N), x);
+
+        grit::doNotOptimize(_buf.front());
+        grit::doNotOptimize(_buf.back());
+    }
+
+private:
+    grit::fft::RealPlan<Float, N> _plan{};
+    etl::array<etl::complex<Float>, N / 2 + 1> _bins{};
+    etl::array<Float, N> _buf{[] {
+        auto rng = etl::xoshiro128plusplus{42};
+        return makeNoise<Float, N>(rng);
+    }()};
+};
+
+template<typename Processor>
+struct StereoProcessor
+{
+    explicit StereoProcessor(float sampleRate)
+    {
+        if constexpr (requires { _left.setSampleRate(sampleRate); }) {
+            _left.setSampleRate(sampleRate);
+            _right.setSampleRate(sampleRate);
+        }
+    }
+
+    auto operator()(grit::StereoBlock<float> const& block) -> void
+    {
+        for (auto i{0U}; i < block.extent(1); ++i) {
+            block(0, i) = _left(block(0, i));
+            block(1, i) = _right(block(1, i));
+        }
+    }
+
+private:
+    Processor _left;
+    Processor _right;
+};
+
+/// Same as StereoProcessor, but deinterleaves into scratch buffers and calls Processor::process.
+template<typename Processor>
+struct StereoBlockProcessor
+{
+    explicit StereoBlockProcessor(float sampleRate)
+    {
+        if constexpr (requires { _left.setSampleRate(sampleRate); }) {
+            _left.setSampleRate(sampleRate);
+            _right.setSampleRate(sampleRate);
+        }
+    }
+
+    auto operator()(grit::StereoBlock<float> const& block) -> void
+    {
+        auto const size = etl::min(block.extent(1), _leftBuffer.size());
+        for (auto i{0U}; i < size; ++i) {
+            _leftBuffer[i]  = block(0, i);
+            _rightBuffer[i] = block(1, i);
+        }
+
+        _left.process(etl::span{_leftBuffer}.first(size), etl::span{_leftBuffer}.first(size));
+        _right.process(etl::span{_rightBuffer}.first(size), etl::span{_rightBuffer}.first(size));
+
+        for (auto i{0U}; i < size; ++i) {
+            block(0, i) = _leftBuffer[i];
+            block(1, i) = _rightBuffer[i];
+        }
+    }
+
+private:
+    Processor _left;
+    Processor _right;
+    etl::array<float, 64> _leftBuffer{};
+    etl::array<float, 64> _rightBuffer{};
+};
+
+/// Same as StereoProcessor, but with a single instance running on packed StereoFrame samples.
+template<typename Processor>
+struct PackedStereoProcessor
+{
+    explicit PackedStereoProcessor(float sampleRate)
+    {
+        if constexpr (requires { _processor.setSampleRate(sampleRate); }) {
+            _processor.setSampleRate(sampleRate);
+        }
+    }
+
+    auto operator()(grit::StereoBlock<float> const& block) -> void { grit::processStereoFrames(_processor, block); }
+
+private:
+    Processor _processor;
+};
+
+/// Biquad has no sample rate, so the benchmark configures a 1 kHz low-pass.
+template<typename Sample>
+struct BiquadLowpass
+{
+    BiquadLowpass() = default;
+
+    auto setSampleRate(float sampleRate) -> void
+    {
+        using Coefficients = typename grit::Biquad<Sample>::Coefficients;
+        _filter.setCoefficients(Coefficients::makeLowPass(1'000.0F, 1.0F / etl::sqrt(2.0F), sampleRate));
+    }
+
+    [[nodiscard]] auto operator()(Sample x) -> Sample { return _filter(x); }
+
+    auto process(etl::span<Sample const> input, etl::span<Sample> output) -> void { _filter.process(input, output); }
+
+private:
+    grit::Biquad<Sample> _filter;
+};
+
+/// Same as BiquadLowpass for the fixed point biquads, which take float coefficients.
+template<typename Filter>
+struct FixedPointBiquadLowpass
+{
+    using SampleType = typename Filter::SampleType;
+
+    FixedPointBiquadLowpass() = default;
+
+    auto setSampleRate(float sampleRate) -> void
+    {
+        using Coefficients = grit::BiquadCoefficients<float>;
+        auto const coefficients = Coefficients::makeLowPass(1'000.0F, 1.0F / etl::sqrt(2.0F), sampleRate);
+        _filter.setCoefficients(etl::span<float const, 6>{coefficients});
+    }
+
+    auto process(etl::span<SampleType const> input, etl::span<SampleType> output) -> void
+    {
+        _filter.process(input, output);
+    }
+
+private:
+    Filter _filter;
+};
+
+/// Same as StereoBlockProcessor for fixed point processors. The conversion from & to
+/// float at the block boundaries is part of the measurement, like for a fixed point
+/// chain fed by the codec.
+template<typename Processor>
+struct FixedPointStereoBlockProcessor
+{
+    using SampleType = typename Processor::SampleType;
+
+    explicit FixedPointStereoBlockProcessor(float sampleRate)
+    {
+        _left.setSampleRate(sampleRate);
+        _right.setSampleRate(sampleRate);
+    }
+
+    auto operator()(grit::StereoBlock<float> const& block) -> void
+    {
+        auto const size = etl::min(block.extent(1), _leftBuffer.size());
+        for (auto i{0U}; i < size; ++i) {
+            _leftBuffer[i]  = toFixed(block(0, i));
+            _rightBuffer[i] = toFixed(block(1, i));
+        }
+
+        _left.process(etl::span{_leftBuffer}.first(size), etl::span{_leftBuffer}.first(size));
+        _right.process(etl::span{_rightBuffer}.first(size), etl::span{_rightBuffer}.first(size));
+
+        for (auto i{0U}; i < size; ++i) {
+            block(0, i) = toFloat(_leftBuffer[i]);
+            block(1, i) = toFloat(_rightBuffer[i]);
+        }
+    }
+
+private:
+    using Raw = decltype(SampleType{}.raw());
+
+    static constexpr auto scale = float(etl::int64_t(1) << SampleType::fractionalBits);
+
+    // Single precision only, SampleType::fromFloat goes through double. The upper
+    // bound is the largest float below 1, so the product never exceeds Raw.
+    [[nodiscard]] static auto toFixed(float x) -> SampleType
+    {
+        return SampleType::fromRaw(static_cast<Raw>(etl::clamp(x, -1.0F, 0.99999994F) * scale));
+    }
+
+    [[nodiscard]] static auto toFloat(SampleType x) -> float { return static_cast<float>(x.raw()) / scale; }
+
+    Processor _left;
+    Processor _right;
+    etl::array<SampleType, 64> _leftBuffer{};
+    etl::array<SampleType, 64> _rightBuffer{};
+};
+
+/// Runs the oscillator like Kyma does, with the input used as phase modulation.
+struct SineWavetable
+{
+    SineWavetable() = default;
+
+    auto setSampleRate(float sampleRate) -> void
+    {
+        _oscillator.setSampleRate(sampleRate);
+        _oscillator.setFrequency(440.0F);
+    }
+
+    [[nodiscard]] auto operator()(float x) -> float
+    {
+        _oscillator.addPhaseOffset(x * 0.01F);
+        return _oscillator();
+    }
+
+private:
+    static constexpr auto sine      = grit::makeSineWavetable<float, 2048>();
+    static constexpr auto wavetable = etl::mdspan{sine.data(), etl::extents<etl::size_t, sine.size()>{}};
+
+    grit::WavetableOscillator<float, sine.size()> _oscillator{wavetable};
+};
+
+/// Same as SineWavetable, reading a guarded copy of the table without wrapping.
+struct GuardedSineWavetable
+{
+    using Interpolation = grit::BufferInterpolation::GuardedHermite;
+
+    GuardedSineWavetable() = default;
+
+    auto setSampleRate(float sampleRate) -> void
+    {
+        _oscillator.setSampleRate(sampleRate);
+        _oscillator.setFrequency(440.0F);
+    }
+
+    [[nodiscard]] auto operator()(float x) -> float
+    {
+        _oscillator.addPhaseOffset(x * 0.01F);
+        return _oscillator();
+    }
+
+private:
+    static constexpr auto sine      = grit::makeGuardedTable(grit::makeSineWavetable<float, 2048>());
+    static constexpr auto wavetable = etl::mdspan{sine.data(), etl::extents<etl::size_t, sine.size()>{}};
+
+    grit::WavetableOscillator<float, sine.size(), Interpolation> _oscillator{wavetable};
+};
+
+/// Same as SineWavetable, but morphing halfway between two frames.
+struct MorphingWavetable
+{
+    MorphingWavetable() = default;
+
+    auto setSampleRate(float sampleRate) -> void
+    {
+        _oscillator.setSampleRate(sampleRate);
+        _oscillator.setFrequency(440.0F);
+        _oscillator.setShapeMorph(0.5F);
+    }
+
+    [[nodiscard]] auto operator()(float x) -> float
+    {
+        _oscillator.addPhaseOffset(x * 0.01F);
+        return _oscillator();
+    }
+
+private:
+    static constexpr auto frames = [] {
+        auto const sine = grit::makeSineWavetable<float, 2048>();
+        auto table      = etl::array<float, sine.size() * 2>{};
+        etl::copy(sine.begin(), sine.end(), table.begin());
+        etl::transform(sine.begin(), sine.end(), table.begin() + sine.size(), [](auto x) { return x * x * x; });
+        return table;
+    }();
+    static constexpr auto wavetable = etl::mdspan{frames.data(), etl::extents<etl::size_t, 2, 2048>{}};
+
+    grit::MorphingWavetableOscillator<float, 2, 2048> _oscillator{wavetable};
+};
+
+/// Same as SineWavetable, but reading a band-limited sawtooth with crossfaded mipmap levels.
+struct MipmappedSawtooth
+{
+    using Wavetable = grit::MipmappedWavetable<float, 1024, 8>;
+
+    MipmappedSawtooth() = default;
+
+    auto setSampleRate(float sampleRate) -> void
+    {
+        _oscillator.setSampleRate(sampleRate);
+        _oscillator.setFrequency(440.0F);
+    }
+
+    [[nodiscard]] auto operator()(float x) -> float
+    {
+        _oscillator.addPhaseOffset(x * 0.01F);
+        return _oscillator();
+    }
+
+private:
+    [[nodiscard]] static auto wavetable() -> Wavetable const&
+    {
+        static auto const table = [] {
+            auto saw = etl::array<float, Wavetable::tableSize()>{};
+            for (auto i = etl::size_t(0); i < saw.size(); ++i) {
+                saw[i] = 2.0F * static_cast<float>(i) / static_cast<float>(saw.size()) - 1.0F;
+            }
+
+            auto mipmap = Wavetable{};
+            mipmap.setWaveform(saw);
+            return mipmap;
+        }();
+        return table;
+    }
+
+    grit::MipmappedWavetableOscillator<float, 1024, 8> _oscillator{wavetable()};
+};
+
+/// Same as MipmappedSawtooth, but morphing halfway to a square like Kyma does.
+struct MipmappedMorphingWavetable
+{
+    using Wavetable = grit::MipmappedWavetable<float, 1024, 8>;
+
+    MipmappedMorphingWavetable() = default;
+
+    auto setSampleRate(float sampleRate) -> void
+    {
+        _oscillator.setSampleRate(sampleRate);
+        _oscillator.setFrequency(440.0F);
+        _oscillator.setShapeMorph(0.5F);
+    }
+
+    [[nodiscard]] auto operator()(float x) -> float
+    {
+        _oscillator.addPhaseOffset(x * 0.01F);
+        return _oscillator();
+    }
+
+private:
+    [[nodiscard]] static auto frames() -> etl::array<Wavetable, 2> const&
+    {
+        static auto const tables = [] {
+            auto saw    = etl::array<float, Wavetable::tableSize()>{};
+            auto square = etl::array<float, Wavetable::tableSize()>{};
+            for (auto i = etl::size_t(0); i < saw.size(); ++i) {
+                saw[i]    = 2.0F * static_cast<float>(i) / static_cast<float>(saw.size()) - 1.0F;
+                square[i] = i < square.size() / 2 ? 1.0F : -1.0F;
+            }
+
+            auto mipmaps = etl::array<Wavetable, 2>{};
+            mipmaps[0].setWaveform(saw);
+            mipmaps[1].setWaveform(square);
+            return mipmaps;
+        }();
+        return tables;
+    }
+
+    grit::MipmappedMorphingWavetableOscillator<float, 2, 1024, 8> _oscillator{frames()};
+};
+
+/// Convolves with a 1024 tap exponentially decaying noise burst, partitioned at the audio block size.
+template<int BlockSize>
+struct CabinetConvolver
+{
+    static constexpr auto irSize = 1024;
+
+    CabinetConvolver()
+    {
+        auto rng = etl::xoshiro128plusplus{42};
+        auto ir  = makeNoise<float, irSize>(rng);
+        for (auto i{0}; i < irSize; ++i) {
+            ir[static_cast<etl::size_t>(i)] *= etl::exp(-float(i) / 128.0F);
+        }
+        _convolver.setImpulseResponse(ir);
+    }
+
+    auto process(etl::span<float const> input, etl::span<float> output) -> void { _convolver.process(input, output); }
+
+private:
+    grit::UniformConvolver<float, BlockSize, irSize / BlockSize> _convolver;
+};
+
+/// Three modulated taps on one buffer, the lfos are plain triangles computed per block.
+struct Chorus
+{
+    using Delay = grit::MultiTapDelay<float, etl::extents<etl::size_t, 4096>, 3>;
+
+    Chorus() = default;
+
+    // The delay points into the member buffer, a copy has to start over on its own.
+    Chorus(Chorus const& other) { setSampleRate(other._sampleRate); }
+
+    auto operator=(Chorus const& other) -> Chorus& = delete;
+
+    auto setSampleRate(float sampleRate) -> void
+    {
+        _sampleRate = sampleRate;
+        _delay.setSampleRate(sampleRate);
+        _delay.setParameter({
+            .taps = {{
+                {.delay = grit::Milliseconds<float>{7.0F}, .gain = 0.5F},
+                {.delay = grit::Milliseconds<float>{11.0F}, .gain = 0.3F},
+                {.delay = grit::Milliseconds<float>{13.0F}, .gain = 0.2F},
+            }},
+            .feedback = 0.2F,
+        });
+        _delay.reset();
+    }
+
+    auto process(etl::span<float const> input, etl::span<float> output) -> void
+    {
+        for (auto t = etl::size_t(0); t < Delay::taps(); ++t) {
+            for (auto i = etl::size_t(0); i < input.size(); ++i) {
+                _phase[t] += 0.00002F * static_cast<float>(t + 1);
+                _phase[t] -= etl::floor(_phase[t]);
+                _modulation[t * input.size() + i] = etl::abs(_phase[t] * 2.0F - 1.0F) * 40.0F;
+            }
+        }
+
+        auto const modulation = Delay::Modulation{_modulation.data(), input.size()};
+        _delay.process(input, output, modulation);
+    }
+
+private:
+    float _sampleRate{0};
+    etl::array<float, 4096> _buffer{};
+    etl::array<float, 64 * Delay::taps()> _modulation{};
+    etl::array<float, Delay::taps()> _phase{};
+    Delay _delay{etl::mdspan{_buffer.data(), etl::extents<etl::size_t, 4096>{}}};
+};
+
+/// Every audio benchmark. The runner is called as runner(name, processor).
+template<int BlockSize, typename Runner>
+auto forEachAudioBenchmark(Runner runner) -> void
+{
+    static constexpr auto fs = float(budgetSampleRate);
+
+    runner("AirWindowsFireAmp", StereoProcessor<grit::AirWindowsFireAmp<float>>{fs});
+    runner("AirWindowsGrindAmp", StereoProcessor<grit::AirWindowsGrindAmp<float>>{fs});
+    runner("AirWindowsVinylDither", StereoProcessor<grit::AirWindowsVinylDither<float>>{fs});
+    runner("TanhClipperADAA1", StereoProcessor<grit::TanhClipperADAA1<float>>{fs});
+    runner("TanhClipperADAA2", StereoProcessor<grit::TanhClipperADAA2<float>>{fs});
+    runner("HardClipper", StereoProcessor<grit::HardClipper<float>>{fs});
+    runner("SoftKneeCompressor", StereoProcessor<grit::SoftKneeCompressor<float>>{fs});
+    runner("TransientShaper", StereoProcessor<grit::TransientShaper<float>>{fs});
+    runner("EnvelopeFollower", StereoProcessor<grit::EnvelopeFollower<float>>{fs});
+    runner("StateVariableLowpass", StereoProcessor<grit::StateVariableLowpass<float>>{fs});
+    runner("Biquad", StereoProcessor<BiquadLowpass<float>>{fs});
+    runner("WavetableOscillator", StereoProcessor<SineWavetable>{fs});
+    runner("WavetableOscillator/guarded", StereoProcessor<GuardedSineWavetable>{fs});
+    runner("MorphingWavetableOscillator", StereoProcessor<MorphingWavetable>{fs});
+    runner("MipmappedWavetableOscillator", StereoProcessor<MipmappedSawtooth>{fs});
+    runner("MipmappedMorphingOscillator", StereoProcessor<MipmappedMorphingWavetable>{fs});
+
+    runner("AirWindowsFireAmp/block", StereoBlockProcessor<grit::AirWindowsFireAmp<float>>{fs});
+    runner("TanhClipperADAA1/block", StereoBlockProcessor<grit::TanhClipperADAA1<float>>{fs});
+    runner("TanhClipperADAA2/block", StereoBlockProcessor<grit::TanhClipperADAA2<float>>{fs});
+    runner("SoftKneeCompressor/block", StereoBlockProcessor<grit::SoftKneeCompressor<float>>{fs});
+    runner("LogDomainCompressor/block", StereoBlockProcessor<grit::LogDomainSoftKneeCompressor<float>>{fs});
+    runner("EnvelopeFollower/block", StereoBlockProcessor<grit::EnvelopeFollower<float>>{fs});
+    runner("StateVariableLowpass/block", StereoBlockProcessor<grit::StateVariableLowpass<float>>{fs});
+    runner("Biquad/block", StereoBlockProcessor<BiquadLowpass<float>>{fs});
+    runner("BiquadQ15/block", FixedPointStereoBlockProcessor<FixedPointBiquadLowpass<grit::BiquadQ15>>{fs});
+    runner("BiquadQ31/block", FixedPointStereoBlockProcessor<FixedPointBiquadLowpass<grit::BiquadQ31>>{fs});
+    runner("HardClipper/2x", StereoBlockProcessor<grit::Oversampled<grit::HardClipper<float>, 2>>{fs});
+    runner("HardClipper/4x", StereoBlockProcessor<grit::Oversampled<grit::HardClipper<float>, 4>>{fs});
+    using Frame = grit::StereoFrame<float>;
+    runner("HardClipper/packed", PackedStereoProcessor<grit::HardClipper<float>>{fs});
+    runner("EnvelopeFollower/packed", PackedStereoProcessor<grit::EnvelopeFollower<Frame>>{fs});
+    runner("LogDomainCompressor/linked", PackedStereoProcessor<grit::LogDomainSoftKneeCompressor<Frame>>{fs});
+    runner("StateVariableLowpass/packed", PackedStereoProcessor<grit::StateVariableLowpass<Frame>>{fs});
+    runner("Biquad/packed", PackedStereoProcessor<BiquadLowpass<Frame>>{fs});
+
+    runner("MultiTapDelay/chorus", StereoBlockProcessor<Chorus>{fs});
+    runner("UniformConvolver/1024", StereoBlockProcessor<CabinetConvolver<BlockSize>>{fs});
+}
+
+/// Every fft benchmark up to MaxSize. The runner is called as runner(name, benchmark).
+template<int MaxSize, typename Runner>
+auto forEachFftBenchmark(Runner runner) -> void
+{
+    auto run = [&runner]<int N>(etl::integral_constant<int, N>) {
+        if constexpr (N <= MaxSize) {
+            runner("ComplexRoundtrip<v3>", ComplexRoundtrip<float, N, c2c_dit2_v3>{});
+            runner("ComplexPlan", StaticComplexRoundtrip<float, N, grit::fft::ComplexPlan>{});
+            runner("ComplexPlanV2", StaticComplexRoundtrip<float, N, grit::fft::ComplexPlanV2>{});
+            runner("ComplexPlan<Radix4>", StaticComplexRoundtrip<float, N, ComplexPlanRadix4>{});
+            runner("ComplexPlan<SplitRadix>", StaticComplexRoundtrip<float, N, ComplexPlanSplitRadix>{});
+            runner("ComplexPlanBitReversed", StaticComplexRoundtrip<float, N, ComplexPlanBitReversed>{});
+            runner("ComplexPlanQ15", ComplexRoundtripQ15<N>{});
+            runner("RealPlan", RealRoundtrip<float, N>{});
+        }
+    };
+
+    run(etl::integral_constant<int, 64>{});
+    run(etl::integral_constant<int, 128>{});
+    run(etl::integral_constant<int, 256>{});
+    run(etl::integral_constant<int, 512>{});
+    run(etl::integral_constant<int, 1024>{});
+    run(etl::integral_constant<int, 2048>{});
+    run(etl::integral_constant<int, 4096>{});
+}
+
+}  // namespace bench
@@ -0,0 +1,176 @@
+#include "benchmark.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace host {
+
+struct Clock
+{
+    [[nodiscard]] static auto now() -> double
+    {
+        using Nanoseconds = std::chrono::duration<double, std::nano>;
+        return Nanoseconds{std::chrono::steady_clock::now().time_since_epoch()}.count();
+    }
+};
+
+[[nodiscard]] auto toString(bench::Kind kind) -> char const*
+{
+    return kind == bench::Kind::Audio ? "audio" : "fft";
+}
+
+auto printTable(std::vector<bench::Result> const& results) -> void
+{
+    std::printf(
+        "%-28s %-5s %6s %6s %12s %12s %12s %10s %9s\n",
+        "name",
+        "kind",
+        "size",
+        "runs",
+        "avg [ns]",
+        "min [ns]",
+        "max [ns]",
+        "ns/sample",
+        "budget %"
+    );
+
+    for (auto const& r : results) {
+        std::printf(
+            "%-28s %-5s %6d %6d %12.1f %12.1f %12.1f %10.2f %9.3f\n",
+            r.name,
+            toString(r.kind),
+            r.size,
+            r.runs,
+            r.average,
+            r.min,
+            r.max,
+            r.nanosecondsPerSample(),
+            r.budgetPercent()
+        );
+    }
+}
+
+auto writeCsv(std::vector<bench::Result> const& results, char const* path) -> bool
+{
+    auto* file = std::fopen(path, "w");
+    if (file == nullptr) {
+        return false;
+    }
+
+    std::fprintf(file, "name,kind,size,runs,average_ns,min_ns,max_ns,ns_per_sample,budget_percent\n");
+    for (auto const& r : results) {
+        std::fprintf(
+            file,
+            "%s,%s,%d,%d,%.3f,%.3f,%.3f,%.4f,%.4f\n",
+            r.name,
+            toString(r.kind),
+            r.size,
+            r.runs,
+            r.average,
+            r.min,
+            r.max,
+            r.nanosecondsPerSample(),
+            r.budgetPercent()
+        );
+    }
+
+    return std::fclose(file) == 0;
+}
+
+auto writeJson(std::vector<bench::Result> const& results, char const* path) -> bool
+{
+    auto* file = std::fopen(path, "w");
+    if (file == nullptr) {
+        return false;
+    }
+
+    std::fprintf(file, "{\n");
+    std::fprintf(
+        file,
+        "  \"budget\": {\"sample_rate\": %.0f, \"block_size\": %d},\n",
+        bench::budgetSampleRate,
+        bench::budgetBlockSize
+    );
+    std::fprintf(file, "  \"results\": [\n");
+    for (auto i = std::size_t(0); i < results.size(); ++i) {
+        auto const& r = results[i];
+        std::fprintf(
+            file,
+            "    {\"name\": \"%s\", \"kind\": \"%s\", \"size\": %d, \"runs\": %d, "
+            "\"average_ns\": %.3f, \"min_ns\": %.3f, \"max_ns\": %.3f, "
+            "\"ns_per_sample\": %.4f, \"budget_percent\": %.4f}%s\n",
+            r.name,
+            toString(r.kind),
+            r.size,
+            r.runs,
+            r.average,
+            r.min,
+            r.max,
+            r.nanosecondsPerSample(),
+            r.budgetPercent(),
+            i + 1 == results.size() ? "" : ","
+        );
+    }
+    std::fprintf(file, "  ]\n");
+    std::fprintf(file, "}\n");
+
+    return std::fclose(file) == 0;
+}
+
+template<int BlockSize>
+auto runAudio(std::vector<bench::Result>& results) -> void
+{
+    bench::forEachAudioBenchmark<BlockSize>([&results](char const* name, auto processor) {
+        results.push_back(bench::audioBench<BlockSize, 4096, Clock>(name, processor));
+    });
+}
+
+auto runFft(std::vector<bench::Result>& results) -> void
+{
+    bench::forEachFftBenchmark<4096>([&results](char const* name, auto benchmark) {
+        results.push_back(bench::fftBench<512, Clock>(name, benchmark));
+    });
+}
+
+}  // namespace host
+
+/// Usage: benchmark-host [--json path] [--csv path]
+auto main(int argc, char** argv) -> int
+{
+    char const* jsonPath = nullptr;
+    char const* csvPath  = nullptr;
+
+    for (auto i{1}; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0 and i + 1 < argc) {
+            jsonPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--csv") == 0 and i + 1 < argc) {
+            csvPath = argv[++i];
+        } else {
+            std::fprintf(stderr, "Usage: %s [--json path] [--csv path]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    auto results = std::vector<bench::Result>{};
+    host::runAudio<16>(results);
+    host::runAudio<32>(results);
+    host::runAudio<64>(results);
+    host::runFft(results);
+
+    host::printTable(results);
+
+    if (jsonPath != nullptr and not host::writeJson(results, jsonPath)) {
+        std::fprintf(stderr, "Failed to write '%s'\n", jsonPath);
+        return EXIT_FAILURE;
+    }
+
+    if (csvPath != nullptr and not host::writeCsv(results, csvPath)) {
+        std::fprintf(stderr, "Failed to write '%s'\n", csvPath);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}